@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <bit>
+#include <lil/Binary.hpp>
+#include <random>
+#include <vector>
+
+using namespace lil;
+
+// The Binary helpers against their C++20 <bit> equivalents over a batch of nonzero values.
+namespace {
+constexpr size_t Count = 4096;
+
+const std::vector<uint64_t>& values()
+{
+  static const auto generated = [] {
+    std::vector<uint64_t> nonzero(Count);
+    std::mt19937_64       random(1);
+    for (auto& value : nonzero)
+    {
+      value = (random() >> (random() % 63)) | (1ULL << (random() % 64));
+    }
+    return nonzero;
+  }();
+  return generated;
+}
+
+template <typename TFn>
+void sumOver(benchmark::State& state, TFn fn)
+{
+  const auto& in = values();
+  for (auto _ : state)
+  {
+    int64_t sum = 0;
+    for (const auto value : in)
+    {
+      sum += fn(value);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+}  // namespace
+
+static void Binary_Clz(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return clz(value); });
+}
+BENCHMARK(Binary_Clz);
+
+static void Std_CountlZero(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return std::countl_zero(value); });
+}
+BENCHMARK(Std_CountlZero);
+
+static void Binary_Ctz(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return ctz(value); });
+}
+BENCHMARK(Binary_Ctz);
+
+static void Std_CountrZero(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return std::countr_zero(value); });
+}
+BENCHMARK(Std_CountrZero);
+
+static void Binary_BitsToRepresent(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return bitsToRepresent(value); });
+}
+BENCHMARK(Binary_BitsToRepresent);
+
+static void Std_BitWidth(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return static_cast<int>(std::bit_width(value)); });
+}
+BENCHMARK(Std_BitWidth);
+
+static void Binary_IntBitsToFit(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return intBitsToFit(value & 63); });
+}
+BENCHMARK(Binary_IntBitsToFit);
+
+static void Std_BitCeil(benchmark::State& state)
+{
+  sumOver(state, [](uint64_t value) { return static_cast<int>(std::max<uint64_t>(8, std::bit_ceil(value & 63))); });
+}
+BENCHMARK(Std_BitCeil);
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+#include <lil/Calibration.hpp>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+using Q16_16 = Fixed<16, 16>;
+
+constexpr size_t Sample_Count = 4096;
+
+const std::vector<uint16_t>& adcSamples()
+{
+  static const auto samples = [] {
+    std::vector<uint16_t> adc(Sample_Count);
+    unsigned              seed = 12345;
+    for (auto& sample : adc)
+    {
+      seed   = (seed * 1103515245u) + 12345u;
+      sample = static_cast<uint16_t>(seed % 4096);
+    }
+    return adc;
+  }();
+  return samples;
+}
+
+constexpr uint16_t Table_Xs[] = { 0, 300, 700, 1200, 1800, 2500, 3300, 4095 };
+constexpr float    Table_Ys[] = { -40.0F, -20.0F, 0.0F, 20.0F, 45.0F, 70.0F, 100.0F, 125.0F };
+}  // namespace
+
+/** What every team writes by hand: a division per sample. */
+static void HandWritten_LinearScale(benchmark::State& state)
+{
+  const auto&        adc = adcSamples();
+  std::vector<float> out(Sample_Count);
+  volatile uint16_t  in_max  = 4095;
+  volatile float     out_max = 3.3F;
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Sample_Count; ++i)
+    {
+      out[i] = (static_cast<float>(adc[i]) * out_max) / static_cast<float>(in_max);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(HandWritten_LinearScale);
+
+static void LinearMap_Float(benchmark::State& state)
+{
+  const auto&                                          adc = adcSamples();
+  std::vector<float>                                   out(Sample_Count);
+  const LinearMap<Interval<uint16_t>, Interval<float>> map({ 0, 4095 }, { 0.0F, 3.3F });
+  for (auto _ : state)
+  {
+    map(adc.data(), out.data(), Sample_Count);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(LinearMap_Float);
+
+static void LinearMap_Fixed(benchmark::State& state)
+{
+  const auto&                                           adc = adcSamples();
+  std::vector<Q16_16>                                   out(Sample_Count);
+  const LinearMap<Interval<uint16_t>, Interval<Q16_16>> map({ 0, 4095 }, { Q16_16(0), Q16_16(3.3) });
+  for (auto _ : state)
+  {
+    map(adc.data(), out.data(), Sample_Count);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(LinearMap_Fixed);
+
+/** Linear search for the segment, then a division to interpolate. */
+static void HandWritten_TableLookup(benchmark::State& state)
+{
+  const auto&        adc = adcSamples();
+  std::vector<float> out(Sample_Count);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Sample_Count; ++i)
+    {
+      size_t segment = 0;
+      while ((segment < 6) && (adc[i] >= Table_Xs[segment + 1]))
+      {
+        ++segment;
+      }
+      const float dx = static_cast<float>(Table_Xs[segment + 1] - Table_Xs[segment]);
+      const float t  = static_cast<float>(adc[i] - Table_Xs[segment]) / dx;
+      out[i]         = Table_Ys[segment] + (t * (Table_Ys[segment + 1] - Table_Ys[segment]));
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(HandWritten_TableLookup);
+
+static void PiecewiseLinear_Float(benchmark::State& state)
+{
+  const auto&                               adc = adcSamples();
+  std::vector<float>                        out(Sample_Count);
+  const PiecewiseLinear<8, uint16_t, float> table(Table_Xs, Table_Ys);
+  for (auto _ : state)
+  {
+    table(adc.data(), out.data(), Sample_Count);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(PiecewiseLinear_Float);
+
+static void PiecewiseLinear_Fixed(benchmark::State& state)
+{
+  Q16_16 ys[8];
+  for (size_t i = 0; i < 8; ++i)
+  {
+    ys[i] = Q16_16(Table_Ys[i]);
+  }
+  const auto&                                adc = adcSamples();
+  std::vector<Q16_16>                        out(Sample_Count);
+  const PiecewiseLinear<8, uint16_t, Q16_16> table(Table_Xs, ys);
+  for (auto _ : state)
+  {
+    table(adc.data(), out.data(), Sample_Count);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(PiecewiseLinear_Fixed);
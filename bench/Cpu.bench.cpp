@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <lil/Cpu.hpp>
+#include <lil/Hash.hpp>
+#include <lil/Utf8.hpp>
+#include <string>
+
+using namespace lil;
+
+// Every variant of each dispatched kernel over 64 KB, indexed by CpuLevel; levels this CPU lacks are skipped.
+namespace {
+const std::string& text()
+{
+  static const std::string text = [] {
+    std::string text;
+    while (text.size() < (64U << 10))
+    {
+      text += "timestamp,sensor/imu/raw,0.25,caf\xC3\xA9\n";
+    }
+    return text;
+  }();
+  return text;
+}
+
+template <typename Function>
+Function variant(benchmark::State& state, const Kernel<Function>& kernel)
+{
+  const auto level = static_cast<CpuLevel>(state.range(0));
+  if ((level > cpuDetected()) || (kernel.variants[state.range(0)] == nullptr))
+  {
+    state.SkipWithError("no variant for this CPU");
+    return nullptr;
+  }
+  state.SetLabel(cpuLevelName(level));
+  return kernel.variants[state.range(0)];
+}
+}  // namespace
+
+static void Cpu_Crc32c(benchmark::State& state)
+{
+  const auto crc32c = variant(state, detail::Crc32c_Kernel);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(crc32c(text().data(), text().size(), 0));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text().size()));
+}
+BENCHMARK(Cpu_Crc32c)->DenseRange(0, Cpu_Levels - 1);
+
+static void Cpu_Utf8Valid(benchmark::State& state)
+{
+  const auto utf8Valid = variant(state, detail::Utf8_Valid_Kernel);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(utf8Valid(text().data(), text().size()));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text().size()));
+}
+BENCHMARK(Cpu_Utf8Valid)->DenseRange(0, Cpu_Levels - 1);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <lil/Fixed.hpp>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+using Q8_8   = Fixed<8, 8>;
+using Q16_16 = Fixed<16, 16>;
+
+constexpr size_t Sample_Count = 4096;
+
+template <typename T>
+std::vector<T> makeSamples(float scale)
+{
+  std::vector<T> samples;
+  for (size_t i = 0; i < Sample_Count; ++i)
+  {
+    samples.emplace_back(static_cast<float>(static_cast<int>(i % 200) - 100) * scale);
+  }
+  return samples;
+}
+}  // namespace
+
+template <typename TFixed>
+static void Fixed_BatchMultiplyAdd(benchmark::State& state)
+{
+  const auto          lhs = makeSamples<TFixed>(0.37F);
+  const auto          rhs = makeSamples<TFixed>(0.11F);
+  std::vector<TFixed> out(Sample_Count);
+  for (auto _ : state)
+  {
+    multiply(lhs.data(), rhs.data(), out.data(), Sample_Count);
+    add(out.data(), lhs.data(), out.data(), Sample_Count);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK_TEMPLATE(Fixed_BatchMultiplyAdd, Q16_16);
+BENCHMARK_TEMPLATE(Fixed_BatchMultiplyAdd, Q8_8);
+
+static void Fixed_ScalarMultiplyAdd(benchmark::State& state)
+{
+  const auto          lhs = makeSamples<Q16_16>(0.37F);
+  const auto          rhs = makeSamples<Q16_16>(0.11F);
+  std::vector<Q16_16> out(Sample_Count);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Sample_Count; ++i)
+    {
+      Err err = Err::NONE;
+      out[i]  = lhs[i].multiply(rhs[i], err).add(lhs[i], err);
+      benchmark::DoNotOptimize(err);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(Fixed_ScalarMultiplyAdd);
+
+/** Hardware float on the host; an upper bound for what an FPU-equipped node would see. */
+static void Float_MultiplyAdd(benchmark::State& state)
+{
+  const auto         lhs = makeSamples<float>(0.37F);
+  const auto         rhs = makeSamples<float>(0.11F);
+  std::vector<float> out(Sample_Count);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Sample_Count; ++i)
+    {
+      out[i] = (lhs[i] * rhs[i]) + lhs[i];
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(Float_MultiplyAdd);
+
+#ifdef __SIZEOF_FLOAT128__
+/** x86-64 has no single precision soft-float routines, but __float128 runs through libgcc's soft-fp implementation, so
+ * it is the closest host stand-in for float on an FPU-less node.
+ */
+static void SoftFloat_MultiplyAdd(benchmark::State& state)
+{
+  const auto              lhs = makeSamples<float>(0.37F);
+  const auto              rhs = makeSamples<float>(0.11F);
+  std::vector<__float128> soft_lhs(lhs.begin(), lhs.end());
+  std::vector<__float128> soft_rhs(rhs.begin(), rhs.end());
+  std::vector<__float128> out(Sample_Count);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Sample_Count; ++i)
+    {
+      out[i] = (soft_lhs[i] * soft_rhs[i]) + soft_lhs[i];
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Sample_Count);
+}
+BENCHMARK(SoftFloat_MultiplyAdd);
+#endif
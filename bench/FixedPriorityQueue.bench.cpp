@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+#include <lil/FixedPriorityQueue.hpp>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+using namespace lil;
+
+// Hold model: a queue of Size pending events repeatedly pops the earliest and pushes a later one, as a scheduler does.
+// Keys are a bare 32 bit deadline, and a 16 byte event whose deadline is compared.
+namespace {
+constexpr size_t Size = 1 << 16;  ///< Big enough that the deeper levels spill out of L2.
+
+struct Event {
+  uint64_t deadline;
+  uint64_t payload;
+};
+
+struct Later {
+  bool operator()(uint32_t lhs, uint32_t rhs) const noexcept { return lhs > rhs; }
+  bool operator()(const Event& lhs, const Event& rhs) const noexcept { return lhs.deadline > rhs.deadline; }
+};
+
+template <typename T>
+T keyAt(uint64_t deadline)
+{
+  if constexpr (std::is_same<T, Event>::value)
+  {
+    return Event{ deadline, deadline * 3 };
+  }
+  else
+  {
+    return static_cast<T>(deadline);
+  }
+}
+
+template <typename T>
+uint64_t deadlineOf(const T& key)
+{
+  if constexpr (std::is_same<T, Event>::value)
+  {
+    return key.deadline;
+  }
+  else
+  {
+    return key;
+  }
+}
+}  // namespace
+
+template <typename T, size_t D>
+static void FixedPriorityQueue_Hold(benchmark::State& state)
+{
+  auto         queue = std::make_unique<FixedPriorityQueue<T, Size, Later, D, false>>();
+  std::mt19937 random(1);
+  for (size_t i = 0; i < Size; ++i)
+  {
+    queue->push(keyAt<T>(random() % Size));
+  }
+  for (auto _ : state)
+  {
+    const auto now = deadlineOf(queue->top());
+    queue->pop();
+    queue->push(keyAt<T>(now + 1 + (random() % Size)));
+  }
+}
+BENCHMARK_TEMPLATE(FixedPriorityQueue_Hold, uint32_t, 2);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_Hold, uint32_t, 4);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_Hold, uint32_t, 8);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_Hold, Event, 2);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_Hold, Event, 4);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_Hold, Event, 8);
+
+template <typename T, size_t D>
+static void FixedPriorityQueue_IndexedHold(benchmark::State& state)
+{
+  auto         queue = std::make_unique<FixedPriorityQueue<T, Size, Later, D>>();
+  std::mt19937 random(1);
+  for (size_t i = 0; i < Size; ++i)
+  {
+    queue->push(keyAt<T>(random() % Size));
+  }
+  for (auto _ : state)
+  {
+    const auto now = deadlineOf(queue->top());
+    queue->pop();
+    queue->push(keyAt<T>(now + 1 + (random() % Size)));
+  }
+}
+BENCHMARK_TEMPLATE(FixedPriorityQueue_IndexedHold, uint32_t, 2);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_IndexedHold, uint32_t, 4);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_IndexedHold, uint32_t, 8);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_IndexedHold, Event, 2);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_IndexedHold, Event, 4);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_IndexedHold, Event, 8);
+
+// Moves a random pending event earlier, e.g. a timeout shortened by new data
+template <typename T, size_t D>
+static void FixedPriorityQueue_DecreaseKey(benchmark::State& state)
+{
+  auto                    queue = std::make_unique<FixedPriorityQueue<T, Size, Later, D>>();
+  std::vector<HeapHandle> handles;
+  std::vector<uint64_t>   deadlines;
+  std::mt19937            random(1);
+  for (size_t i = 0; i < Size; ++i)
+  {
+    deadlines.push_back(UINT32_MAX - (random() % Size));
+    handles.push_back(*queue->push(keyAt<T>(deadlines.back())));
+  }
+  for (auto _ : state)
+  {
+    const auto i = random() % Size;
+    deadlines[i] -= 1 + (random() % 64);
+    queue->update(handles[i], keyAt<T>(deadlines[i]));
+  }
+}
+BENCHMARK_TEMPLATE(FixedPriorityQueue_DecreaseKey, uint32_t, 2);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_DecreaseKey, uint32_t, 4);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_DecreaseKey, uint32_t, 8);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_DecreaseKey, Event, 2);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_DecreaseKey, Event, 4);
+BENCHMARK_TEMPLATE(FixedPriorityQueue_DecreaseKey, Event, 8);
+
+template <typename T>
+static void StdPriorityQueue_Hold(benchmark::State& state)
+{
+  std::priority_queue<T, std::vector<T>, Later> queue;
+  std::mt19937                                  random(1);
+  for (size_t i = 0; i < Size; ++i)
+  {
+    queue.push(keyAt<T>(random() % Size));
+  }
+  for (auto _ : state)
+  {
+    const auto now = deadlineOf(queue.top());
+    queue.pop();
+    queue.push(keyAt<T>(now + 1 + (random() % Size)));
+  }
+}
+BENCHMARK_TEMPLATE(StdPriorityQueue_Hold, uint32_t);
+BENCHMARK_TEMPLATE(StdPriorityQueue_Hold, Event);
@@ -0,0 +1,94 @@
+#include <FreeRTOS.h>
+#include <benchmark/benchmark.h>
+#include <lil/Task.hpp>
+#include <task.h>
+
+using namespace lil;
+
+// The round trips of Task.bench measured under the FreeRTOS Linux simulator: handing the CPU to another FreeRTOS task
+// and back with direct to task notifications, the kernel's fastest primitive, next to a lil Executor doing the same
+// inside one FreeRTOS task. Built only when find_package(FreeRTOS) finds the kernel sources, as its own executable
+// because the scheduler must own the thread that runs the benchmarks.
+namespace {
+constexpr uint32_t Stack_Words = 16384;  ///< Google Benchmark needs far more stack than configMINIMAL_STACK_SIZE.
+
+StaticTask_t Bench_Tcb;
+StackType_t  Bench_Stack[Stack_Words];
+TaskHandle_t Bench_Task;
+StaticTask_t Echo_Tcb;
+StackType_t  Echo_Stack[configMINIMAL_STACK_SIZE * 4];
+TaskHandle_t Echo_Task;
+
+void echoNotifications(void*)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    xTaskNotifyGive(Bench_Task);
+  }
+}
+
+void runBenchmarks(void*)
+{
+  benchmark::RunSpecifiedBenchmarks();
+  vTaskEndScheduler();
+}
+
+uint32_t tickClock() noexcept
+{
+  return static_cast<uint32_t>(xTaskGetTickCount());
+}
+
+Task<void> echo(Event& ping, Event& pong, const bool& stop)
+{
+  while (!stop)
+  {
+    co_await ping.wait();
+    ping.reset();
+    pong.set();
+  }
+}
+}  // namespace
+
+static void FreeRTOS_NotifyRoundTrip(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    xTaskNotifyGive(Echo_Task);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+BENCHMARK(FreeRTOS_NotifyRoundTrip)->UseRealTime();
+
+static void FreeRTOS_TaskEventRoundTrip(benchmark::State& state)
+{
+  Executor executor(tickClock);
+  Event    ping;
+  Event    pong;
+  bool     stop = false;
+  executor.spawn(echo(ping, pong, stop));
+  executor.runOnce();
+  for (auto _ : state)
+  {
+    ping.set();
+    executor.runOnce();
+    pong.reset();
+  }
+  stop = true;
+  ping.set();
+  executor.run();
+}
+BENCHMARK(FreeRTOS_TaskEventRoundTrip)->UseRealTime();
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  // Equal priorities, so each notification switches tasks only when its sender blocks on the reply
+  Bench_Task = xTaskCreateStatic(runBenchmarks, "bench", Stack_Words, nullptr, tskIDLE_PRIORITY + 1, Bench_Stack,
+                                 &Bench_Tcb);
+  Echo_Task  = xTaskCreateStatic(echoNotifications, "echo", configMINIMAL_STACK_SIZE * 4, nullptr,
+                                 tskIDLE_PRIORITY + 1, Echo_Stack, &Echo_Tcb);
+  vTaskStartScheduler();
+  benchmark::Shutdown();
+  return 0;
+}
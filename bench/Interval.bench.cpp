@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <lil/Interval.hpp>
+#include <random>
+#include <vector>
+
+using namespace lil;
+
+// Interval operations over a batch of samples against the std algorithms that do the same job.
+namespace {
+constexpr size_t Count = 4096;
+
+const std::vector<float>& samples()
+{
+  static const auto values = [] {
+    std::vector<float>                    generated(Count);
+    std::mt19937                          random(1);
+    std::uniform_real_distribution<float> distribution(-2.0F, 2.0F);
+    for (auto& value : generated)
+    {
+      value = distribution(random);
+    }
+    return generated;
+  }();
+  return values;
+}
+}  // namespace
+
+static void Interval_Clip(benchmark::State& state)
+{
+  const Interval<float> limits{ -1.0F, 1.0F };
+  const auto&           in = samples();
+  std::vector<float>    out(Count);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Count; ++i)
+    {
+      out[i] = limits.clip(in[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Interval_Clip);
+
+static void Std_Clamp(benchmark::State& state)
+{
+  const auto&        in = samples();
+  std::vector<float> out(Count);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Count; ++i)
+    {
+      out[i] = std::clamp(in[i], -1.0F, 1.0F);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Std_Clamp);
+
+static void Interval_InRange(benchmark::State& state)
+{
+  const Interval<float> limits{ -1.0F, 1.0F };
+  const auto&           in = samples();
+  for (auto _ : state)
+  {
+    size_t inside = 0;
+    for (size_t i = 0; i < Count; ++i)
+    {
+      inside += limits.inRange(in[i]) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(inside);
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Interval_InRange);
+
+static void Std_CountIfInRange(benchmark::State& state)
+{
+  const auto& in = samples();
+  for (auto _ : state)
+  {
+    const auto inside =
+      std::count_if(in.begin(), in.end(), [](float value) { return (value >= -1.0F) && (value <= 1.0F); });
+    benchmark::DoNotOptimize(inside);
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Std_CountIfInRange);
+
+static void Interval_Intersect(benchmark::State& state)
+{
+  const auto&     in = samples();
+  Interval<float> common{ -2.0F, 2.0F };
+  for (auto _ : state)
+  {
+    for (size_t i = 0; (i + 1) < Count; i += 2)
+    {
+      common = Interval<float>::intersect(common, Interval<float>{ in[i], in[i + 1] });
+    }
+    benchmark::DoNotOptimize(common);
+  }
+  state.SetItemsProcessed(state.iterations() * (Count / 2));
+}
+BENCHMARK(Interval_Intersect);
+
+static void Std_MinMaxIntersect(benchmark::State& state)
+{
+  const auto& in   = samples();
+  float       low  = -2.0F;
+  float       high = 2.0F;
+  for (auto _ : state)
+  {
+    for (size_t i = 0; (i + 1) < Count; i += 2)
+    {
+      const auto [min, max] = std::minmax(in[i], in[i + 1]);
+      low                   = std::max(low, min);
+      high                  = std::min(high, max);
+    }
+    benchmark::DoNotOptimize(low);
+    benchmark::DoNotOptimize(high);
+  }
+  state.SetItemsProcessed(state.iterations() * (Count / 2));
+}
+BENCHMARK(Std_MinMaxIntersect);
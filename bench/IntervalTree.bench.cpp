@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <lil/IntervalTree.hpp>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+constexpr size_t Interval_Count = 100000;
+
+std::vector<Interval<float>> makeIntervals(size_t count)
+{
+  std::vector<Interval<float>> intervals;
+  unsigned                     seed = 12345;
+  for (size_t i = 0; i < count; ++i)
+  {
+    seed             = (seed * 1103515245u) + 12345u;
+    const float min  = static_cast<float>(seed % 1000000);
+    seed             = (seed * 1103515245u) + 12345u;
+    const float span = static_cast<float>(seed % 100);
+    intervals.emplace_back(min, min + span);
+  }
+  return intervals;
+}
+
+const std::vector<Interval<float>>& intervals()
+{
+  static const auto intervals = makeIntervals(Interval_Count);
+  return intervals;
+}
+
+IntervalTree<float, Interval_Count>& tree()
+{
+  static IntervalTree<float, Interval_Count> tree;
+  static const Err                          built = tree.build(intervals().data(), intervals().size());
+  (void)built;
+  return tree;
+}
+}  // namespace
+
+static void IntervalTree_Stab(benchmark::State& state)
+{
+  const auto& stabbed = tree();
+  float       value   = 0.0F;
+  for (auto _ : state)
+  {
+    size_t hits = stabbed.stab(value, [](size_t, const Interval<float>&) {});
+    benchmark::DoNotOptimize(hits);
+    value = (value < 1000000.0F) ? (value + 7919.0F) : 0.0F;
+  }
+}
+BENCHMARK(IntervalTree_Stab);
+
+static void LinearScan_Stab(benchmark::State& state)
+{
+  const auto& scanned = intervals();
+  float       value   = 0.0F;
+  for (auto _ : state)
+  {
+    size_t hits = 0;
+    for (const auto& interval : scanned)
+    {
+      hits += interval.inRange(value);
+    }
+    benchmark::DoNotOptimize(hits);
+    value = (value < 1000000.0F) ? (value + 7919.0F) : 0.0F;
+  }
+}
+BENCHMARK(LinearScan_Stab);
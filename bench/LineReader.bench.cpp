@@ -0,0 +1,132 @@
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <lil/LineReader.hpp>
+#include <lil/Str.hpp>
+#include <lil/ThreadPool.hpp>
+#include <string>
+#include <thread>
+
+using namespace lil;
+
+// A 64 MB capture of CSV-like lines, read as views, as copies into Str, with std::getline and in parallel chunks.
+namespace {
+const std::string& capture()
+{
+  static const std::string path = [] {
+    std::string   name = "/tmp/lil_line_reader.bench.csv";
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    std::string   line;
+    for (size_t written = 0, i = 0; written < (64U << 20); written += line.size(), ++i)
+    {
+      line = std::to_string(i * 1000) + ",sensor/imu/" + std::to_string(i % 64) + "/raw," + std::to_string(i % 977) +
+             ".25\n";
+      file << line;
+    }
+    return name;
+  }();
+  return path;
+}
+
+size_t fileBytes()
+{
+  LineReader reader;
+  reader.open(capture().c_str());
+  return reader.size();
+}
+}  // namespace
+
+static void LineReader_Mapped(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    LineReader reader;
+    reader.open(capture().c_str());
+    size_t records = 0;
+    while (auto record = reader.next())
+    {
+      benchmark::DoNotOptimize(record->data());
+      ++records;
+    }
+    benchmark::DoNotOptimize(records);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileBytes()));
+}
+BENCHMARK(LineReader_Mapped)->Unit(benchmark::kMillisecond);
+
+static void LineReader_Read(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    LineReader reader;
+    reader.open(capture().c_str(), '\n', LineReader::Mode::Read);
+    size_t records = 0;
+    while (auto record = reader.next())
+    {
+      benchmark::DoNotOptimize(record->data());
+      ++records;
+    }
+    benchmark::DoNotOptimize(records);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileBytes()));
+}
+BENCHMARK(LineReader_Read)->Unit(benchmark::kMillisecond);
+
+static void LineReader_FillStr(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    LineReader reader;
+    reader.open(capture().c_str());
+    Str<64> line;
+    while (reader.next(line) == NONE)
+    {
+      benchmark::DoNotOptimize(line.data());
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileBytes()));
+}
+BENCHMARK(LineReader_FillStr)->Unit(benchmark::kMillisecond);
+
+static void LineReader_Getline(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::ifstream file(capture(), std::ios::binary);
+    std::string   line;
+    size_t        records = 0;
+    while (std::getline(file, line))
+    {
+      benchmark::DoNotOptimize(line.data());
+      ++records;
+    }
+    benchmark::DoNotOptimize(records);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileBytes()));
+}
+BENCHMARK(LineReader_Getline)->Unit(benchmark::kMillisecond);
+
+static void LineReader_Split(benchmark::State& state)
+{
+  ThreadPool pool(std::thread::hardware_concurrency());
+  for (auto _ : state)
+  {
+    LineReader reader;
+    reader.open(capture().c_str());
+    std::string_view    chunks[64];
+    std::atomic<size_t> records{ 0 };
+    parallelFor(pool, chunks, reader.split(chunks, 64), [&](std::string_view chunk) {
+      Records walk(chunk);
+      size_t  counted = 0;
+      while (auto record = walk.next())
+      {
+        benchmark::DoNotOptimize(record->data());
+        ++counted;
+      }
+      records.fetch_add(counted, std::memory_order_relaxed);
+    });
+    benchmark::DoNotOptimize(records.load());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileBytes()));
+}
+BENCHMARK(LineReader_Split)->Unit(benchmark::kMillisecond)->UseRealTime();
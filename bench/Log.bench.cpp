@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include <lil/Log.hpp>
+#include <stdio.h>
+
+using namespace lil;
+
+namespace {
+void drain()
+{
+  uint8_t bytes[64];
+  while (logBuffer().read(bytes, sizeof(bytes)) != 0)
+  {
+  }
+}
+}  // namespace
+
+static void Log_Binary(benchmark::State& state)
+{
+  uint32_t sample = 0;
+  for (auto _ : state)
+  {
+    LIL_LOG("adc channel %u read %u at %f V", 3U, sample, 1.25F);
+    ++sample;
+    if (logBuffer().size() > (logBuffer().capacity() / 2))
+    {
+      drain();
+    }
+  }
+  benchmark::DoNotOptimize(logDropped());
+}
+BENCHMARK(Log_Binary);
+
+static void Log_Snprintf(benchmark::State& state)
+{
+  uint32_t sample = 0;
+  char     line[64];
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(snprintf(line, sizeof(line), "adc channel %u read %u at %f V", 3U, sample, 1.25));
+    ++sample;
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(Log_Snprintf);
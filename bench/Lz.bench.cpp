@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+#include <lil/Lz.hpp>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace lil;
+
+// 64 KB of telemetry as the logs and samples nodes buffer before uplink: CSV lines, and packed binary records of slowly
+// changing readings. Reports MB/s of uncompressed data and the ratio of uncompressed to compressed bytes.
+namespace {
+struct Sample {
+  uint64_t timestamp;
+  uint16_t sensor;
+  uint16_t status;
+  int32_t  value;
+};
+
+const std::string& csv()
+{
+  static const std::string text = [] {
+    std::string text;
+    for (size_t line = 0; text.size() < (64U << 10); ++line)
+    {
+      text += std::to_string(1700000000000 + (line * 10)) + ",imu/" + std::to_string(line % 3) + ",accel," +
+              std::to_string(980 + ((line * 7) % 13)) + ",OK\n";
+    }
+    return text;
+  }();
+  return text;
+}
+
+const std::string& binary()
+{
+  static const std::string text = [] {
+    std::string text((64U << 10) / sizeof(Sample) * sizeof(Sample), '\0');
+    for (size_t i = 0; i < (text.size() / sizeof(Sample)); ++i)
+    {
+      const Sample sample{ 1700000000000 + (i * 10), static_cast<uint16_t>(i % 4), 0,
+                           static_cast<int32_t>(1000 + ((i * 7) % 13)) };
+      memcpy(&text[i * sizeof(Sample)], &sample, sizeof(sample));
+    }
+    return text;
+  }();
+  return text;
+}
+
+const std::string& input(const benchmark::State& state)
+{
+  return (state.range(0) == 0) ? csv() : binary();
+}
+
+void report(benchmark::State& state, size_t size, size_t compressed)
+{
+  state.SetLabel((state.range(0) == 0) ? "csv" : "binary");
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+  state.counters["ratio"] = static_cast<double>(size) / static_cast<double>(compressed);
+}
+
+template <uint8_t WindowBits, uint8_t LookaheadBits>
+size_t lzssCompress(LzssEncoder<WindowBits, LookaheadBits>& encoder, const std::string& text, std::vector<char>& out)
+{
+  encoder.reset();
+  size_t offset  = 0;
+  size_t written = 0;
+  while (!encoder.finished())
+  {
+    if (offset < text.size())
+    {
+      offset += encoder.sink(&text[offset], text.size() - offset);
+    }
+    else
+    {
+      encoder.finish();
+    }
+    written += encoder.poll(&out[written], out.size() - written);
+  }
+  return written;
+}
+}  // namespace
+
+template <uint8_t WindowBits, uint8_t LookaheadBits>
+static void Lz_LzssCompress(benchmark::State& state)
+{
+  static LzssEncoder<WindowBits, LookaheadBits> encoder;
+  const auto&                                   text = input(state);
+  std::vector<char>                             out(2 * text.size());
+  size_t                                        compressed = 0;
+  for (auto _ : state)
+  {
+    compressed = lzssCompress(encoder, text, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  report(state, text.size(), compressed);
+}
+BENCHMARK_TEMPLATE(Lz_LzssCompress, 8, 4)->DenseRange(0, 1);
+BENCHMARK_TEMPLATE(Lz_LzssCompress, 10, 5)->DenseRange(0, 1);
+
+template <uint8_t WindowBits, uint8_t LookaheadBits>
+static void Lz_LzssDecompress(benchmark::State& state)
+{
+  static LzssEncoder<WindowBits, LookaheadBits> encoder;
+  static LzssDecoder<WindowBits, LookaheadBits> decoder;
+  const auto&                                   text = input(state);
+  std::vector<char>                             compressed(2 * text.size());
+  std::vector<char>                             out(text.size());
+  const auto                                    size = lzssCompress(encoder, text, compressed);
+  for (auto _ : state)
+  {
+    decoder.reset();
+    size_t offset  = 0;
+    size_t written = 0;
+    while (offset < size)
+    {
+      offset  += decoder.sink(&compressed[offset], size - offset);
+      written += decoder.poll(&out[written], out.size() - written);
+    }
+    benchmark::DoNotOptimize(written);
+  }
+  report(state, text.size(), size);
+}
+BENCHMARK_TEMPLATE(Lz_LzssDecompress, 8, 4)->DenseRange(0, 1);
+BENCHMARK_TEMPLATE(Lz_LzssDecompress, 10, 5)->DenseRange(0, 1);
+
+static void Lz_Lz4Compress(benchmark::State& state)
+{
+  static Lz4Encoder<> encoder;
+  const auto&         text = input(state);
+  std::vector<char>   out(lz4Bound(text.size()));
+  size_t              compressed = 0;
+  for (auto _ : state)
+  {
+    compressed = encoder.compress(text.data(), text.size(), out.data(), out.size()).value_or(0);
+    benchmark::DoNotOptimize(out.data());
+  }
+  report(state, text.size(), compressed);
+}
+BENCHMARK(Lz_Lz4Compress)->DenseRange(0, 1);
+
+static void Lz_Lz4Decompress(benchmark::State& state)
+{
+  static Lz4Encoder<> encoder;
+  const auto&         text = input(state);
+  std::vector<char>   compressed(lz4Bound(text.size()));
+  std::vector<char>   out(text.size());
+  const auto size = encoder.compress(text.data(), text.size(), compressed.data(), compressed.size()).value_or(0);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(lz4Decompress(compressed.data(), size, out.data(), out.size()));
+  }
+  report(state, text.size(), size);
+}
+BENCHMARK(Lz_Lz4Decompress)->DenseRange(0, 1);
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <lil/Pipeline.hpp>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+constexpr size_t Channels = 8;
+constexpr size_t Factor   = 4;
+
+using Average = MovingAverage<float, 8, Channels>;
+using Filter  = Biquad<float, Channels>;
+using Limit   = Clip<float, Channels>;
+using Dead    = Deadband<float, Channels>;
+using Drop    = Decimate<float, Factor, Channels>;
+using Frame   = float[Channels];
+
+constexpr BiquadCoefficients<float> Lowpass{ 0.2929F, 0.5858F, 0.2929F, 0.0F, 0.1716F };
+constexpr Interval<float>           Limits{ -1.0F, 1.0F };
+constexpr Interval<float>           Band{ -0.05F, 0.05F };
+
+std::vector<float> makeSamples(size_t frames)
+{
+  std::vector<float> samples;
+  for (size_t i = 0; i < (frames * Channels); ++i)
+  {
+    samples.push_back(static_cast<float>(static_cast<int>((i * 7919) % 401) - 200) / 150.0F);
+  }
+  return samples;
+}
+}  // namespace
+
+static void Pipeline_Fused(benchmark::State& state)
+{
+  // Stages normally live in static storage; as locals the optimizer may scalarize their state in ways firmware won't
+  static Pipeline    pipeline{ Average{}, Filter{ Lowpass }, Limit{ Limits }, Dead{ Band }, Drop{} };
+  const auto         frames = static_cast<size_t>(state.range(0));
+  const auto         in     = makeSamples(frames);
+  std::vector<float> out(in.size());
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(pipeline.process(in.data(), out.data(), frames));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * frames * Channels);
+}
+BENCHMARK(Pipeline_Fused)->RangeMultiplier(8)->Range(1 << 9, 1 << 18);
+
+static void Pipeline_SeparatePasses(benchmark::State& state)
+{
+  static Average     average;
+  static Filter      filter{ Lowpass };
+  static Limit       limit{ Limits };
+  static Dead        dead{ Band };
+  static Drop        drop;
+  const auto         frames = static_cast<size_t>(state.range(0));
+  const auto         in     = makeSamples(frames);
+  std::vector<float> out(in.size());
+  auto*              block = reinterpret_cast<Frame*>(out.data());
+  for (auto _ : state)
+  {
+    std::copy(in.begin(), in.end(), out.begin());
+    average.process(block, frames);
+    filter.process(block, frames);
+    limit.process(block, frames);
+    dead.process(block, frames);
+    benchmark::DoNotOptimize(drop.process(block, frames));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * frames * Channels);
+}
+BENCHMARK(Pipeline_SeparatePasses)->RangeMultiplier(8)->Range(1 << 9, 1 << 18);
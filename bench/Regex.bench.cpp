@@ -0,0 +1,204 @@
+#include <benchmark/benchmark.h>
+#include <lil/Regex.hpp>
+#include <regex>
+#include <string_view>
+
+using namespace lil;
+
+// Our validation patterns three ways: lil::Regex, std::regex, and the loops we would otherwise write by hand. Each
+// iteration checks every text of a set that mixes valid and invalid inputs.
+namespace {
+#define IDENTIFIER   "[A-Za-z_][A-Za-z0-9_]*"
+#define TOPIC_FILTER R"((?:[a-z0-9_]+|\+)(?:/(?:[a-z0-9_]+|\+))*(?:/#)?|#)"
+#define VERSION      R"((\d+)\.(\d+)\.(\d+)(?:-(\w+))?)"
+
+constexpr std::string_view Identifiers[]   = { "imu_raw", "_Temperature2", "9lives", "gyro-x", "accelerometer_x_axis" };
+constexpr std::string_view Topic_Filters[] = { "sensor/imu/raw", "sensor/+/raw", "sensor/#", "sensor/#/raw", "a//b" };
+constexpr std::string_view Versions[]      = { "1.2.3", "10.20.300-rc1", "1.2", "v1.2.3", "2023.11.07-nightly_4" };
+
+constexpr bool isWord(char chr)
+{
+  return ((chr >= 'a') && (chr <= 'z')) || ((chr >= 'A') && (chr <= 'Z')) || ((chr >= '0') && (chr <= '9')) ||
+         (chr == '_');
+}
+
+constexpr bool isDigit(char chr)
+{
+  return (chr >= '0') && (chr <= '9');
+}
+
+bool handIdentifier(std::string_view text)
+{
+  if (text.empty() || isDigit(text[0]))
+  {
+    return false;
+  }
+  for (const auto chr : text)
+  {
+    if (!isWord(chr))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool handTopicFilter(std::string_view text)
+{
+  for (size_t begin = 0;;)
+  {
+    auto end   = text.find('/', begin);
+    end        = (end == std::string_view::npos) ? text.size() : end;
+    auto level = text.substr(begin, end - begin);
+    if (level == "#")
+    {
+      return end == text.size();
+    }
+    if (level.empty())
+    {
+      return false;
+    }
+    for (const auto chr : level)
+    {
+      if ((level != "+") && !(isWord(chr) && !((chr >= 'A') && (chr <= 'Z'))))
+      {
+        return false;
+      }
+    }
+    if (end == text.size())
+    {
+      return true;
+    }
+    begin = end + 1;
+  }
+}
+
+/** @brief Parses a version the way a hand-written parser would, returning where its parts end. */
+bool handVersion(std::string_view text, std::string_view (&parts)[5])
+{
+  size_t pos = 0;
+  for (size_t part = 1; part <= 3; ++part)
+  {
+    const auto begin = pos;
+    while ((pos < text.size()) && isDigit(text[pos]))
+    {
+      ++pos;
+    }
+    if (pos == begin)
+    {
+      return false;
+    }
+    parts[part] = text.substr(begin, pos - begin);
+    if (part < 3)
+    {
+      if ((pos == text.size()) || (text[pos] != '.'))
+      {
+        return false;
+      }
+      ++pos;
+    }
+  }
+  parts[4] = {};
+  if (pos < text.size())
+  {
+    if ((text[pos] != '-') || ((pos + 1) == text.size()))
+    {
+      return false;
+    }
+    parts[4] = text.substr(pos + 1);
+    for (const auto chr : parts[4])
+    {
+      if (!isWord(chr))
+      {
+        return false;
+      }
+    }
+  }
+  parts[0] = text;
+  return true;
+}
+
+template <typename TMatch, size_t Count>
+void run(benchmark::State& state, const std::string_view (&texts)[Count], TMatch&& match)
+{
+  for (auto _ : state)
+  {
+    size_t matches = 0;
+    for (const auto text : texts)
+    {
+      benchmark::DoNotOptimize(text.data());
+      matches += match(text) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.counters["per_text"] = benchmark::Counter(static_cast<double>(Count),
+                                                  benchmark::Counter::kIsIterationInvariantRate |
+                                                      benchmark::Counter::kInvert);
+}
+}  // namespace
+
+static void Regex_Identifier(benchmark::State& state)
+{
+  run(state, Identifiers, [](std::string_view text) { return Regex<IDENTIFIER>::match(text); });
+}
+BENCHMARK(Regex_Identifier);
+
+static void StdRegex_Identifier(benchmark::State& state)
+{
+  const std::regex regex(IDENTIFIER);
+  run(state, Identifiers, [&](std::string_view text) { return std::regex_match(text.begin(), text.end(), regex); });
+}
+BENCHMARK(StdRegex_Identifier);
+
+static void Hand_Identifier(benchmark::State& state)
+{
+  run(state, Identifiers, handIdentifier);
+}
+BENCHMARK(Hand_Identifier);
+
+static void Regex_TopicFilter(benchmark::State& state)
+{
+  run(state, Topic_Filters, [](std::string_view text) { return Regex<TOPIC_FILTER>::match(text); });
+}
+BENCHMARK(Regex_TopicFilter);
+
+static void StdRegex_TopicFilter(benchmark::State& state)
+{
+  const std::regex regex(TOPIC_FILTER);
+  run(state, Topic_Filters, [&](std::string_view text) { return std::regex_match(text.begin(), text.end(), regex); });
+}
+BENCHMARK(StdRegex_TopicFilter);
+
+static void Hand_TopicFilter(benchmark::State& state)
+{
+  run(state, Topic_Filters, handTopicFilter);
+}
+BENCHMARK(Hand_TopicFilter);
+
+static void Regex_Version(benchmark::State& state)
+{
+  run(state, Versions, [](std::string_view text) {
+    Regex<VERSION>::Captures version;
+    return Regex<VERSION>::match(text, version) && !version[1].empty();
+  });
+}
+BENCHMARK(Regex_Version);
+
+static void StdRegex_Version(benchmark::State& state)
+{
+  const std::regex regex(VERSION);
+  run(state, Versions, [&](std::string_view text) {
+    std::match_results<std::string_view::const_iterator> version;
+    return std::regex_match(text.begin(), text.end(), version, regex) && (version[1].length() > 0);
+  });
+}
+BENCHMARK(StdRegex_Version);
+
+static void Hand_Version(benchmark::State& state)
+{
+  run(state, Versions, [](std::string_view text) {
+    std::string_view version[5];
+    return handVersion(text, version) && !version[1].empty();
+  });
+}
+BENCHMARK(Hand_Version);
@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+#include <lil/Result.hpp>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+using namespace lil;
+
+// Each pair of functions does identical work, differing only in how the error is returned. They are kept out of line so
+// the comparison measures the calling convention rather than what the optimizer can see through.
+namespace {
+constexpr size_t Count = 1024;
+
+struct Entry {
+  uint32_t key;
+  uint32_t value;
+};
+
+Entry Table[Count];
+char  Digits[Count][6];
+
+__attribute__((noinline)) Err parseOut(const char* text, uint32_t& out)
+{
+  uint32_t value = 0;
+  for (; *text != '\0'; ++text)
+  {
+    if ((*text < '0') || (*text > '9'))
+    {
+      return INVALID_FORMAT;
+    }
+    value = (value * 10) + static_cast<uint32_t>(*text - '0');
+  }
+  out = value;
+  return NONE;
+}
+
+__attribute__((noinline)) Result<uint32_t> parseResult(const char* text)
+{
+  uint32_t value = 0;
+  for (; *text != '\0'; ++text)
+  {
+    if ((*text < '0') || (*text > '9'))
+    {
+      return INVALID_FORMAT;
+    }
+    value = (value * 10) + static_cast<uint32_t>(*text - '0');
+  }
+  return value;
+}
+
+__attribute__((noinline)) Err findOut(uint32_t key, Entry*& out)
+{
+  const auto index = key % Count;
+  if (Table[index].key != key)
+  {
+    return RESOURCE_EMPTY;
+  }
+  out = &Table[index];
+  return NONE;
+}
+
+__attribute__((noinline)) Result<Entry*> findResult(uint32_t key)
+{
+  const auto index = key % Count;
+  if (Table[index].key != key)
+  {
+    return RESOURCE_EMPTY;
+  }
+  return &Table[index];
+}
+
+void fill()
+{
+  for (size_t i = 0; i < Count; ++i)
+  {
+    Table[i] = Entry{ static_cast<uint32_t>((i % 7 == 0) ? (i + 1) : i), static_cast<uint32_t>(i * 3) };
+    snprintf(Digits[i], sizeof(Digits[i]), (i % 9 == 0) ? "%zux" : "%zu", i * 37);
+  }
+}
+}  // namespace
+
+static void Result_ParseErrOutParam(benchmark::State& state)
+{
+  fill();
+  for (auto _ : state)
+  {
+    uint32_t sum = 0;
+    for (const auto& text : Digits)
+    {
+      uint32_t value = 0;
+      if (parseOut(text, value) == NONE)
+      {
+        sum += value;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Result_ParseErrOutParam);
+
+static void Result_ParseResult(benchmark::State& state)
+{
+  fill();
+  for (auto _ : state)
+  {
+    uint32_t sum = 0;
+    for (const auto& text : Digits)
+    {
+      sum += parseResult(text).value_or(0);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Result_ParseResult);
+
+static void Result_FindErrOutParam(benchmark::State& state)
+{
+  fill();
+  for (auto _ : state)
+  {
+    uint32_t sum = 0;
+    for (uint32_t key = 0; key < Count; ++key)
+    {
+      Entry* entry = nullptr;
+      if (findOut(key, entry) == NONE)
+      {
+        sum += entry->value;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Result_FindErrOutParam);
+
+static void Result_FindResult(benchmark::State& state)
+{
+  fill();
+  for (auto _ : state)
+  {
+    uint32_t sum = 0;
+    for (uint32_t key = 0; key < Count; ++key)
+    {
+      const auto entry = findResult(key);
+      if (entry.ok())
+      {
+        sum += entry->value;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(Result_FindResult);
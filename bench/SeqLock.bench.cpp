@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <lil/SeqLock.hpp>
+#include <lil/Snapshot.hpp>
+#include <mutex>
+#include <shared_mutex>
+
+using namespace lil;
+
+// Reader scaling for read-mostly configuration: every thread reads a 64 byte struct, and thread 0 also writes it once
+// every Write_Period reads.
+namespace {
+constexpr int64_t Write_Period = 4096;
+
+struct Config {
+  uint32_t generation;
+  float    coefficients[15];
+};
+
+class SharedMutexConfig {
+public:
+  Config read() const
+  {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    return _config;
+  }
+
+  void write(const Config& config)
+  {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    _config = config;
+  }
+
+private:
+  mutable std::shared_mutex _mutex;
+  Config                    _config{};
+};
+
+SeqLock<Config>   Seq_Lock_Config;
+Snapshot<Config>  Snapshot_Config;
+SharedMutexConfig Shared_Mutex_Config;
+
+template <typename TShared, typename TWrite>
+void readMostly(benchmark::State& state, TShared& shared, TWrite write)
+{
+  Config  config{};
+  int64_t reads = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(shared.read());
+    if ((state.thread_index() == 0) && (++reads % Write_Period == 0))
+    {
+      ++config.generation;
+      write(shared, config);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+static void SeqLock_ReadMostly(benchmark::State& state)
+{
+  readMostly(state, Seq_Lock_Config, [](auto& shared, const Config& config) { shared.write(config); });
+}
+BENCHMARK(SeqLock_ReadMostly)->ThreadRange(1, 16)->UseRealTime();
+
+static void Snapshot_ReadMostly(benchmark::State& state)
+{
+  readMostly(state, Snapshot_Config, [](auto& shared, const Config& config) { shared.publish(config); });
+}
+BENCHMARK(Snapshot_ReadMostly)->ThreadRange(1, 16)->UseRealTime();
+
+static void SharedMutex_ReadMostly(benchmark::State& state)
+{
+  readMostly(state, Shared_Mutex_Config, [](auto& shared, const Config& config) { shared.write(config); });
+}
+BENCHMARK(SharedMutex_ReadMostly)->ThreadRange(1, 16)->UseRealTime();
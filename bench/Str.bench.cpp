@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+#include <lil/Str.hpp>
+#include <string>
+
+using namespace lil;
+
+// Str against std::string for the same edits. Short texts fit std::string's small buffer; long ones make it allocate.
+namespace {
+constexpr const char Short_Text[] = "sensor/imu";
+constexpr const char Long_Text[]  = "sensor/imu/accelerometer/x-axis/raw-counts";
+constexpr const char Insertion[]  = "/filtered";
+
+const char* textFor(const benchmark::State& state)
+{
+  return (state.range(0) == 0) ? Short_Text : Long_Text;
+}
+}  // namespace
+
+static void Str_Construct(benchmark::State& state)
+{
+  const char* text = textFor(state);
+  benchmark::DoNotOptimize(text);
+  for (auto _ : state)
+  {
+    Str<64> str(text);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(Str_Construct)->Arg(0)->Arg(1);
+
+static void StdString_Construct(benchmark::State& state)
+{
+  const char* text = textFor(state);
+  benchmark::DoNotOptimize(text);
+  for (auto _ : state)
+  {
+    std::string str(text);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(StdString_Construct)->Arg(0)->Arg(1);
+
+static void Str_Insert(benchmark::State& state)
+{
+  const Str<64> base(textFor(state));
+  for (auto _ : state)
+  {
+    auto str = base;
+    str.insert(6, Insertion);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(Str_Insert)->Arg(0)->Arg(1);
+
+static void StdString_Insert(benchmark::State& state)
+{
+  const std::string base(textFor(state));
+  for (auto _ : state)
+  {
+    auto str = base;
+    str.insert(6, Insertion);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(StdString_Insert)->Arg(0)->Arg(1);
+
+static void Str_Erase(benchmark::State& state)
+{
+  const Str<64> base(textFor(state));
+  for (auto _ : state)
+  {
+    auto str = base;
+    str.erase(2, 4);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(Str_Erase)->Arg(0)->Arg(1);
+
+static void StdString_Erase(benchmark::State& state)
+{
+  const std::string base(textFor(state));
+  for (auto _ : state)
+  {
+    auto str = base;
+    str.erase(2, 4);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(StdString_Erase)->Arg(0)->Arg(1);
+
+static void Str_Append(benchmark::State& state)
+{
+  const char* text = textFor(state);
+  for (auto _ : state)
+  {
+    Str<128> str;
+    str.append(text).append(Insertion).append(text);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(Str_Append)->Arg(0)->Arg(1);
+
+static void StdString_Append(benchmark::State& state)
+{
+  const char* text = textFor(state);
+  for (auto _ : state)
+  {
+    std::string str;
+    str.append(text).append(Insertion).append(text);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(StdString_Append)->Arg(0)->Arg(1);
+
+static void Str_Concatenate(benchmark::State& state)
+{
+  const Str<64> lhs(textFor(state));
+  const Str<16> rhs(Insertion);
+  for (auto _ : state)
+  {
+    auto str = lhs % rhs;
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(Str_Concatenate)->Arg(0)->Arg(1);
+
+static void StdString_Concatenate(benchmark::State& state)
+{
+  const std::string lhs(textFor(state));
+  const std::string rhs(Insertion);
+  for (auto _ : state)
+  {
+    auto str = lhs + rhs;
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(StdString_Concatenate)->Arg(0)->Arg(1);
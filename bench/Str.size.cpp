@@ -0,0 +1,37 @@
+#include <lil/Str.hpp>
+#include <stddef.h>
+#include <utility>
+
+using namespace lil;
+
+// Uses every Str operation at 40 capacities, roughly as many as a firmware image does, for lil_size_report.py to weigh
+// what each capacity adds to the image. The operations run on main()'s arguments so nothing folds away.
+namespace {
+using Sizes = std::integer_sequence<uint8_t, 4, 6, 8, 10, 12, 14, 16, 18, 20, 24, 28, 32, 36, 40, 44, 48, 56, 64, 72,
+                                    80, 88, 96, 104, 112, 120, 128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208,
+                                    216, 224, 240, 255>;
+
+template <uint8_t Size>
+[[gnu::noinline]] size_t exercise(const char* text)
+{
+  Str<Size> str(text);
+  str.insert(1, text).insert(0, 2, '-').erase(3, 2);
+  str.append(text).append(3, '.') += '!';
+  str.erase(str.begin());
+  Str<Size> copy(str);
+  copy.push_back('?');
+  copy.pop_back();
+  return copy.size() + static_cast<size_t>(copy[0]);
+}
+
+template <uint8_t... Size>
+size_t exerciseAll(const char* text, std::integer_sequence<uint8_t, Size...>)
+{
+  return (exercise<Size>(text) + ...);
+}
+}  // namespace
+
+int main(int, char** argv)
+{
+  return static_cast<int>(exerciseAll(argv[0], Sizes{}) & 0x7F);
+}
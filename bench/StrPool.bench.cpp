@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+#include <lil/Str.hpp>
+#include <lil/StrPool.hpp>
+#include <string.h>
+#include <string>
+
+using namespace lil;
+
+// Records naming their device, topic and unit as Str<32>, as they used to, against the same records holding StrIds.
+namespace {
+constexpr size_t Names   = 256;
+constexpr size_t Records = 4096;
+
+using Pool = StrPool<Names, Names * 32>;
+
+struct StrRecord {
+  Str<32> device;
+  Str<32> topic;
+  Str<32> unit;
+  float   value;
+};
+
+struct IdRecord {
+  Pool::Id device;
+  Pool::Id topic;
+  Pool::Id unit;
+  float    value;
+};
+
+std::string nameFor(size_t i)
+{
+  return "sensor/imu/" + std::to_string(i) + "/raw";
+}
+
+/** @brief What comparing two names costs without interning. */
+bool operator==(const Str<32>& left, const Str<32>& right)
+{
+  return (left.size() == right.size()) && (memcmp(left.data(), right.data(), left.size()) == 0);
+}
+
+Pool& filledPool()
+{
+  static Pool pool;
+  for (size_t i = 0; i < Names; ++i)
+  {
+    pool.intern(nameFor(i).c_str());
+  }
+  return pool;
+}
+}  // namespace
+
+static void StrPool_InternHit(benchmark::State& state)
+{
+  auto&             pool = filledPool();
+  const std::string name = nameFor(Names / 2);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(pool.intern(name.data(), name.size()));
+  }
+}
+BENCHMARK(StrPool_InternHit);
+
+static void StrPool_FindMiss(benchmark::State& state)
+{
+  const auto&       pool = filledPool();
+  const std::string name = nameFor(Names * 2);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(pool.find(name.data(), name.size()));
+  }
+}
+BENCHMARK(StrPool_FindMiss);
+
+static void StrPool_CompareIds(benchmark::State& state)
+{
+  auto&    pool  = filledPool();
+  Pool::Id left  = *pool.find(nameFor(7).c_str());
+  Pool::Id right = *pool.find(nameFor(7).c_str());
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(left);
+    benchmark::DoNotOptimize(right);
+    benchmark::DoNotOptimize(left == right);
+  }
+}
+BENCHMARK(StrPool_CompareIds);
+
+static void Str_Compare(benchmark::State& state)
+{
+  Str<32> left(nameFor(7).c_str());
+  Str<32> right(nameFor(7).c_str());
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(left);
+    benchmark::DoNotOptimize(right);
+    benchmark::DoNotOptimize(left == right);
+  }
+}
+BENCHMARK(Str_Compare);
+
+/** @brief Counts the records matching one topic, with the RAM each layout takes per record. */
+static void StrRecord_Scan(benchmark::State& state)
+{
+  static StrRecord records[Records];
+  for (size_t i = 0; i < Records; ++i)
+  {
+    records[i] = { nameFor(i % 16).c_str(), nameFor(i % Names).c_str(), nameFor(i % 4).c_str(), 1.0F };
+  }
+  const Str<32> topic(nameFor(Names / 2).c_str());
+  for (auto _ : state)
+  {
+    size_t matches = 0;
+    for (const auto& record : records)
+    {
+      matches += (record.topic == topic) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.counters["bytes_per_record"] = sizeof(StrRecord);
+}
+BENCHMARK(StrRecord_Scan);
+
+static void IdRecord_Scan(benchmark::State& state)
+{
+  auto&           pool = filledPool();
+  static IdRecord records[Records];
+  for (size_t i = 0; i < Records; ++i)
+  {
+    records[i] = { *pool.intern(nameFor(i % 16).c_str()), *pool.intern(nameFor(i % Names).c_str()),
+                   *pool.intern(nameFor(i % 4).c_str()), 1.0F };
+  }
+  const auto topic = *pool.find(nameFor(Names / 2).c_str());
+  for (auto _ : state)
+  {
+    size_t matches = 0;
+    for (const auto& record : records)
+    {
+      matches += (record.topic == topic) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.counters["bytes_per_record"] = sizeof(IdRecord);
+  state.counters["pool_bytes"]       = sizeof(Pool);
+}
+BENCHMARK(IdRecord_Scan);
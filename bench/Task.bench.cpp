@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <condition_variable>
+#include <lil/Task.hpp>
+#include <mutex>
+#include <thread>
+
+using namespace lil;
+
+// Latency of handing control to another task and back. The FreeRTOS Linux port runs each task on a pthread and hands
+// the CPU over with signals, so a condition variable ping-pong between two threads is the closest host equivalent of a
+// FreeRTOS task switch; FreeRTOS.bench.cpp measures the real one when the kernel sources are available.
+namespace {
+uint32_t hostClock() noexcept
+{
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+}
+
+Task<void> echo(Event& ping, Event& pong, const bool& stop)
+{
+  while (!stop)
+  {
+    co_await ping.wait();
+    ping.reset();
+    pong.set();
+  }
+}
+}  // namespace
+
+static void Task_EventRoundTrip(benchmark::State& state)
+{
+  Executor executor(hostClock);
+  Event    ping;
+  Event    pong;
+  bool     stop = false;
+  executor.spawn(echo(ping, pong, stop));
+  executor.runOnce();
+  for (auto _ : state)
+  {
+    ping.set();
+    executor.runOnce();
+    pong.reset();
+  }
+  stop = true;
+  ping.set();
+  executor.run();
+}
+BENCHMARK(Task_EventRoundTrip);
+
+static void Thread_ConditionVariableRoundTrip(benchmark::State& state)
+{
+  std::mutex              mutex;
+  std::condition_variable changed;
+  bool                    ping = false;
+  bool                    stop = false;
+  std::thread             echo([&] {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop)
+    {
+      changed.wait(lock, [&] { return ping || stop; });
+      ping = false;
+      changed.notify_one();
+    }
+  });
+  for (auto _ : state)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    ping = true;
+    changed.notify_one();
+    changed.wait(lock, [&] { return !ping; });
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  changed.notify_one();
+  echo.join();
+}
+BENCHMARK(Thread_ConditionVariableRoundTrip)->UseRealTime();
@@ -0,0 +1,23 @@
+#include <benchmark/benchmark.h>
+#include <lil/Telemetry.hpp>
+
+using namespace lil;
+
+static void Telemetry_CountErr(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(countErr(CHECKSUM));
+  }
+}
+BENCHMARK(Telemetry_CountErr);
+
+static void Telemetry_Snapshot(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    auto snapshot = ErrSnapshot::take();
+    benchmark::DoNotOptimize(&snapshot);
+  }
+}
+BENCHMARK(Telemetry_Snapshot);
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <lil/Calibration.hpp>
+#include <lil/Hash.hpp>
+#include <lil/ThreadPool.hpp>
+#include <vector>
+
+using namespace lil;
+
+// Scaling of the parallel algorithms over lil's batch kernels. lil has no CRC, so FNV-1a record hashing stands in for
+// bulk checksumming. Thread counts beyond the host's cores measure the overhead of idle workers.
+namespace {
+constexpr size_t Records      = 1 << 14;
+constexpr size_t Record_Bytes = 64;
+constexpr size_t Samples      = 1 << 20;
+
+const std::vector<char>& records()
+{
+  static const auto bytes = [] {
+    std::vector<char> data(Records * Record_Bytes);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      data[i] = static_cast<char>((i * 7919) >> 3);
+    }
+    return data;
+  }();
+  return bytes;
+}
+
+const std::vector<uint16_t>& adcSamples()
+{
+  static const auto samples = [] {
+    std::vector<uint16_t> adc(Samples);
+    for (size_t i = 0; i < adc.size(); ++i)
+    {
+      adc[i] = static_cast<uint16_t>((i * 2654435761U) >> 20);
+    }
+    return adc;
+  }();
+  return samples;
+}
+}  // namespace
+
+static void Parallel_HashRecords(benchmark::State& state)
+{
+  ThreadPool  pool(static_cast<size_t>(state.range(0)));
+  const auto& data = records();
+  for (auto _ : state)
+  {
+    const auto digest = parallelReduce(
+      pool, Records, uint32_t{ 0 },
+      [&](size_t begin, size_t end) {
+        uint32_t combined = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+          combined ^= fnv1a(&data[i * Record_Bytes], Record_Bytes);
+        }
+        return combined;
+      },
+      [](uint32_t lhs, uint32_t rhs) { return lhs ^ rhs; });
+    benchmark::DoNotOptimize(digest);
+  }
+  state.SetBytesProcessed(state.iterations() * Records * Record_Bytes);
+}
+BENCHMARK(Parallel_HashRecords)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+static void Parallel_ClipSamples(benchmark::State& state)
+{
+  ThreadPool               pool(static_cast<size_t>(state.range(0)));
+  const auto&              adc = adcSamples();
+  std::vector<uint16_t>    out(Samples);
+  const Interval<uint16_t> limits{ 100, 4000 };
+  for (auto _ : state)
+  {
+    parallelTransform(pool, adc.data(), Samples, out.data(), [&](uint16_t sample) { return limits.clip(sample); });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(Parallel_ClipSamples)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+static void Parallel_CalibrateSamples(benchmark::State& state)
+{
+  ThreadPool                                           pool(static_cast<size_t>(state.range(0)));
+  const auto&                                          adc = adcSamples();
+  std::vector<float>                                   volts(Samples);
+  const LinearMap<Interval<uint16_t>, Interval<float>> map({ 0, 4095 }, { 0.0F, 3.3F });
+  for (auto _ : state)
+  {
+    parallelFor(pool, Samples, [&](size_t begin, size_t end) { map(&adc[begin], &volts[begin], end - begin); });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * Samples);
+}
+BENCHMARK(Parallel_CalibrateSamples)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <lil/TimingWheel.hpp>
+#include <list>
+#include <random>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+constexpr size_t Timers = 1 << 17;
+
+using Wheel = TimingWheel<Timers>;
+
+std::minstd_rand Random(1);
+
+void rearm(void* context, TimerId)
+{
+  auto* wheel = static_cast<Wheel*>(context);
+  benchmark::DoNotOptimize(wheel->schedule(Random() % 30000, rearm, wheel));
+}
+
+/** @brief Returns a wheel with Timers pending, filled on first use since the benchmarks are run repeatedly. */
+template <int Instance>
+Wheel& filled(std::vector<TimerId>& ids)
+{
+  static Wheel wheel;
+  if (wheel.size() == 0)
+  {
+    for (size_t i = 0; i < Timers; ++i)
+    {
+      ids.push_back(*wheel.schedule(Random() % 30000, rearm, &wheel));
+    }
+  }
+  return wheel;
+}
+}  // namespace
+
+// Cancel a random pending timer and schedule a replacement, with 128k timers pending
+static void TimingWheel_CancelSchedule(benchmark::State& state)
+{
+  static std::vector<TimerId> ids;
+  auto&                       wheel = filled<0>(ids);
+  for (auto _ : state)
+  {
+    auto& id = ids[Random() % Timers];
+    wheel.cancel(id);
+    id = *wheel.schedule(Random() % 30000, rearm, &wheel);
+  }
+}
+BENCHMARK(TimingWheel_CancelSchedule);
+
+// One tick of a 1 kHz clock with 128k self-rearming timers, about four expiries per tick
+static void TimingWheel_Tick(benchmark::State& state)
+{
+  std::vector<TimerId> ids;
+  auto&                wheel = filled<1>(ids);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(wheel.advance(wheel.now() + 1));
+  }
+}
+BENCHMARK(TimingWheel_Tick);
+
+// The structure being replaced: a deadline sorted list, where insert and cancel walk the list
+static void SortedList_CancelSchedule(benchmark::State& state)
+{
+  using List = std::list<uint32_t>;
+  List                        timers;
+  std::vector<List::iterator> handles;
+  std::minstd_rand            random(1);
+  auto                        insert = [&](uint32_t deadline) {
+    return timers.insert(std::find_if(timers.begin(), timers.end(), [&](uint32_t d) { return d > deadline; }), deadline);
+  };
+  std::vector<uint32_t> deadlines(static_cast<size_t>(state.range(0)));
+  std::generate(deadlines.begin(), deadlines.end(), [&] { return random() % 30000; });
+  std::sort(deadlines.begin(), deadlines.end());
+  for (auto deadline : deadlines)
+  {
+    handles.push_back(timers.insert(timers.end(), deadline));
+  }
+  for (auto _ : state)
+  {
+    auto& handle = handles[random() % handles.size()];
+    timers.erase(handle);
+    handle = insert(random() % 30000);
+  }
+}
+BENCHMARK(SortedList_CancelSchedule)->Arg(1 << 10)->Arg(1 << 17);
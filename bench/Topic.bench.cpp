@@ -0,0 +1,131 @@
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <lil/ByteRing.hpp>
+#include <lil/Topic.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace lil;
+
+// Cost of delivering one message to N subscribers. The baseline is the callback registry Topic replaces, which copies
+// each message into every subscriber's byte queue and back out again.
+namespace {
+constexpr size_t Max_Subscribers = 32;
+
+struct Frame {
+  uint32_t sequence;
+  uint8_t  payload[252];
+};
+
+using FrameTopic = Topic<Frame, 16, Max_Subscribers, 16>;
+using FrameQueue = ByteRing<16 * sizeof(Frame)>;
+
+std::vector<FrameTopic::Subscriber> subscribeAll(FrameTopic& topic, size_t count)
+{
+  std::vector<FrameTopic::Subscriber> subscribers;
+  for (size_t i = 0; i < count; ++i)
+  {
+    subscribers.push_back(*topic.subscribe());
+  }
+  return subscribers;
+}
+}  // namespace
+
+static void Topic_PublishReceive(benchmark::State& state)
+{
+  auto       topic       = std::make_unique<FrameTopic>(str_literal("bench"));
+  const auto subscribers = subscribeAll(*topic, static_cast<size_t>(state.range(0)));
+  uint32_t   sequence    = 0;
+  for (auto _ : state)
+  {
+    auto frame        = topic->loan();
+    frame->sequence   = sequence++;
+    frame->payload[0] = static_cast<uint8_t>(sequence);
+    topic->publish(frame.value());
+    for (const auto& subscriber : subscribers)
+    {
+      const auto received = subscriber.receive();
+      benchmark::DoNotOptimize(received->payload[0]);
+      subscriber.release(received.value());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Topic_PublishReceive)->RangeMultiplier(2)->Range(1, Max_Subscribers);
+
+static void CopyingRegistry_PublishReceive(benchmark::State& state)
+{
+  auto     queues = std::make_unique<FrameQueue[]>(static_cast<size_t>(state.range(0)));
+  Frame    frame{};
+  Frame    received;
+  uint32_t sequence = 0;
+  for (auto _ : state)
+  {
+    frame.sequence   = sequence++;
+    frame.payload[0] = static_cast<uint8_t>(sequence);
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+      queues[i].write(&frame, sizeof(frame));
+    }
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+      queues[i].read(&received, sizeof(received));
+      benchmark::DoNotOptimize(received.payload[0]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(CopyingRegistry_PublishReceive)->RangeMultiplier(2)->Range(1, Max_Subscribers);
+
+// Sustained rate with the subscribers drained by another thread; the publisher retries whenever they lag
+static void Topic_Throughput(benchmark::State& state)
+{
+  auto              topic       = std::make_unique<FrameTopic>(str_literal("bench"));
+  const auto        subscribers = subscribeAll(*topic, static_cast<size_t>(state.range(0)));
+  std::atomic<bool> stop{ false };
+  std::thread       consumer([&] {
+    while (!stop.load(std::memory_order_relaxed))
+    {
+      bool idle = true;
+      for (const auto& subscriber : subscribers)
+      {
+        while (auto received = subscriber.receive())
+        {
+          benchmark::DoNotOptimize(received->sequence);
+          subscriber.release(received.value());
+          idle = false;
+        }
+      }
+      if (idle)
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+  uint32_t sequence = 0;
+  int64_t  lagged   = 0;
+  for (auto _ : state)
+  {
+    for (;;)
+    {
+      auto frame = topic->loan();
+      if (frame)
+      {
+        frame->sequence = sequence;
+        if (topic->publish(frame.value()) == NONE)
+        {
+          break;
+        }
+      }
+      ++lagged;
+      std::this_thread::yield();
+    }
+    ++sequence;
+  }
+  stop = true;
+  consumer.join();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["lagged"] = benchmark::Counter(static_cast<double>(lagged), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(Topic_Throughput)->RangeMultiplier(2)->Range(1, Max_Subscribers)->UseRealTime();
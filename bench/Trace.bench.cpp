@@ -0,0 +1,95 @@
+#define LIL_TRACE_ENABLED true
+
+#include <benchmark/benchmark.h>
+#include <lil/Trace.hpp>
+
+using namespace lil;
+
+namespace {
+constexpr size_t Batch = detail::Trace_Events / 2;  ///< Zones per iteration, drained outside the timed region.
+
+void drain(benchmark::State& state)
+{
+  state.PauseTiming();
+  char json[16 * 1024];
+  while (auto written = traceFlush(json, sizeof(json)))
+  {
+    if (*written == 0)
+    {
+      break;
+    }
+  }
+  state.ResumeTiming();
+}
+
+void perZone(benchmark::State& state)
+{
+  state.counters["per_zone"] = benchmark::Counter(static_cast<double>(Batch),
+                                                  benchmark::Counter::kIsIterationInvariantRate |
+                                                      benchmark::Counter::kInvert);
+}
+}  // namespace
+
+/** @brief The loop without zones, i.e. what LIL_TRACE_ZONE costs when LIL_TRACE_ENABLED is false. */
+static void Trace_Baseline(benchmark::State& state)
+{
+  uint32_t work = 0;
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Batch; ++i)
+    {
+      benchmark::DoNotOptimize(++work);
+    }
+  }
+  perZone(state);
+}
+BENCHMARK(Trace_Baseline);
+
+static void Trace_Clock(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Batch; ++i)
+    {
+      benchmark::DoNotOptimize(LIL_TRACE_CLOCK());
+    }
+  }
+  perZone(state);
+}
+BENCHMARK(Trace_Clock);
+
+static void Trace_Zone(benchmark::State& state)
+{
+  uint32_t work = 0;
+  for (auto _ : state)
+  {
+    drain(state);
+    for (size_t i = 0; i < Batch; ++i)
+    {
+      LIL_TRACE_ZONE("Trace_Zone");
+      benchmark::DoNotOptimize(++work);
+    }
+  }
+  perZone(state);
+  state.counters["dropped"] = traceDropped();
+}
+BENCHMARK(Trace_Zone);
+
+static void Trace_NestedZones(benchmark::State& state)
+{
+  uint32_t work = 0;
+  for (auto _ : state)
+  {
+    drain(state);
+    for (size_t i = 0; i < (Batch / 2); ++i)
+    {
+      LIL_TRACE_ZONE("outer");
+      {
+        LIL_TRACE_ZONE("inner");
+        benchmark::DoNotOptimize(++work);
+      }
+    }
+  }
+  perZone(state);
+}
+BENCHMARK(Trace_NestedZones);
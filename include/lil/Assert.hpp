@@ -1,10 +1,17 @@
 #pragma once
 
-//#include <xlu/macro.hpp>
+// std
+#include <atomic>
+#include <stdint.h>
+
+// local
 #include <lil/Err.hpp>
+#include <lil/Hash.hpp>
+#include <lil/detail/Intern.hpp>
+#include <lil/detail/Macro.hpp>
 
-#ifndef XLU_FILENAME
-#  define XLU_FILENAME __FILE__
+#ifndef LIL_FILENAME
+#  define LIL_FILENAME __FILE__
 #endif
 
 namespace lil {
@@ -22,10 +29,69 @@ namespace lil {
 //};
 //#endif
 
-void AssertFail(Err err, const char* expression, const char* fileLine) noexcept(false);
+/** @brief Handles a failed LIL_ASSERT; defined by the application, e.g. to log and reset or to throw.
+ * @param id The site's ID, from which tools/python/lil_log_decode.py recovers its expression and "file:line".
+ */
+void AssertFail(Err err, uint32_t id) noexcept(false);
+
+/** @brief Counts the failures of one LIL_ASSERT call site.
+ *
+ * Like a LIL_LOG call site, a site interns its expression and "file:line" in a lil_log.* section that need not occupy
+ * flash, and is identified at runtime by the 32 bit FNV-1a hash of that entry. Sites live in static storage and cost
+ * nothing until they first fail, at which point they push themselves onto a lock-free list so that telemetry can
+ * enumerate every site that has ever failed without a registry or linker script.
+ */
+class AssertSite {
+public:
+  constexpr explicit AssertSite(uint32_t id) noexcept
+      : _id(id)
+      , _failures(0)
+      , _next(nullptr)
+  {
+  }
+
+  AssertSite(const AssertSite&)            = delete;
+  AssertSite& operator=(const AssertSite&) = delete;
+
+  /** @brief Records a failure; safe to call from any context. */
+  void fail() noexcept
+  {
+    if (_failures.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+      link();
+    }
+  }
+
+  uint32_t id() const noexcept { return _id; }
+  uint32_t failures() const noexcept { return _failures.load(std::memory_order_relaxed); }
+
+  /** @brief Returns the most recently linked site that has failed, or nullptr; continue with next(). */
+  static const AssertSite* first() noexcept;
+  const AssertSite*        next() const noexcept { return _next; }
+
+private:
+  uint32_t              _id;
+  std::atomic<uint32_t> _failures;
+  const AssertSite*     _next;  ///< Written once, before the site is published by link().
+
+  void link() noexcept;
+};
 }  // namespace lil
 
-#ifndef XLU_ASSERT
-#  define XLU_ASSERT(expr, err) \
-    if (!(expr)) { xlu::AssertFail(err, #expr, XLU_FILENAME ":" XSTRINGIFY(__LINE__)); }
-#endif  // XLU_ASSERT
+/** @brief The interned text of an assert site: magic, "file:line", NUL, expression. */
+#define LIL_ASSERT_ENTRY(expr) LIL_LOG_MAGIC LIL_FILENAME ":" LIL_STRINGIFY(__LINE__) "\0" #expr
+
+#ifndef LIL_ASSERT
+#  define LIL_ASSERT(expr, err)                                                                                         \
+    do                                                                                                                  \
+    {                                                                                                                   \
+      if (!(expr))                                                                                                      \
+      {                                                                                                                 \
+        LIL_LOG_SECTION static const char lil_assert_entry[] = LIL_ASSERT_ENTRY(expr);                                  \
+        constexpr uint32_t lil_assert_id = ::lil::fnv1a(LIL_ASSERT_ENTRY(expr), sizeof(LIL_ASSERT_ENTRY(expr)) - 1);    \
+        static ::lil::AssertSite lil_assert_site{ lil_assert_id };                                                      \
+        lil_assert_site.fail();                                                                                         \
+        ::lil::AssertFail(err, lil_assert_site.id());                                                                   \
+      }                                                                                                                 \
+    } while (false)
+#endif  // LIL_ASSERT
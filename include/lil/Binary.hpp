@@ -23,6 +23,18 @@ constexpr int clz(uint32_t value) noexcept
   return __builtin_clz(value);
 }
 
+/** @pre value != 0 */
+constexpr int ctz(uint64_t value) noexcept
+{
+  return __builtin_ctzll(value);
+}
+
+/** @pre value != 0 */
+constexpr int ctz(uint32_t value) noexcept
+{
+  return __builtin_ctz(value);
+}
+
 constexpr int bitsToRepresent(uint64_t value) noexcept
 {
   return Bit_Count_v<uint64_t> - clz(value);
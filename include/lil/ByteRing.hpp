@@ -0,0 +1,187 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// local
+#include <lil/Err.hpp>
+
+namespace lil {
+
+namespace detail {
+/** @brief Copies count bytes into a ring of N bytes at the free-running position, wrapping around its end. */
+template <size_t N>
+void ringCopyIn(uint8_t (&ring)[N], size_t position, const uint8_t* data, size_t count) noexcept
+{
+  const auto offset = position & (N - 1);
+  const auto first  = ((N - offset) < count) ? (N - offset) : count;
+  memcpy(&ring[offset], data, first);
+  memcpy(&ring[0], data + first, count - first);
+}
+
+template <size_t N>
+void ringCopyOut(const uint8_t (&ring)[N], size_t position, uint8_t* out, size_t count) noexcept
+{
+  const auto offset = position & (N - 1);
+  const auto first  = ((N - offset) < count) ? (N - offset) : count;
+  memcpy(out, &ring[offset], first);
+  memcpy(out + first, &ring[0], count - first);
+}
+}  // namespace detail
+
+/** @brief A lock-free single producer, single consumer FIFO of bytes, e.g. between an ISR and a background task.
+ *
+ * The head and tail are free-running counters masked on use, so every one of the N bytes is usable and neither side
+ * ever writes the other's index. Exactly one context may call write() and exactly one other context may call read().
+ * @tparam N Capacity in bytes; must be a power of two.
+ */
+template <size_t N>
+class ByteRing {
+public:
+  static_assert((N > 0) && ((N & (N - 1)) == 0), "ByteRing capacity must be a power of two");
+
+  constexpr ByteRing() noexcept
+      : _head(0)
+      , _tail(0)
+      , _data{}
+  {
+  }
+
+  ByteRing(const ByteRing&)            = delete;
+  ByteRing& operator=(const ByteRing&) = delete;
+
+  /** @brief Returns the number of bytes waiting to be read. Exact for the consumer, a lower bound otherwise. */
+  size_t size() const noexcept
+  {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+
+  constexpr size_t capacity() const noexcept { return N; }
+  bool             empty() const noexcept { return size() == 0; }
+
+  /** @brief Producer: appends all count bytes, or none of them.
+   * @return Err::RESOURCE_FULL if fewer than count bytes are free.
+   */
+  Err write(const void* data, size_t count) noexcept
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+    const auto tail = _tail.load(std::memory_order_acquire);
+    if ((N - (head - tail)) < count)
+    {
+      return Err::RESOURCE_FULL;
+    }
+    detail::ringCopyIn(_data, head, static_cast<const uint8_t*>(data), count);
+    _head.store(head + count, std::memory_order_release);
+    return Err::NONE;
+  }
+
+  /** @brief Consumer: moves up to count bytes into out.
+   * @return Number of bytes read.
+   */
+  size_t read(void* out, size_t count) noexcept
+  {
+    const auto tail      = _tail.load(std::memory_order_relaxed);
+    const auto head      = _head.load(std::memory_order_acquire);
+    const auto available = head - tail;
+    const auto taken     = (count < available) ? count : available;
+    detail::ringCopyOut(_data, tail, static_cast<uint8_t*>(out), taken);
+    _tail.store(tail + taken, std::memory_order_release);
+    return taken;
+  }
+
+private:
+  std::atomic<size_t> _head;  ///< Total bytes ever written; owned by the producer.
+  std::atomic<size_t> _tail;  ///< Total bytes ever read; owned by the consumer.
+  uint8_t             _data[N];
+};
+
+/** @brief A lock-free multiple producer, single consumer FIFO of bytes, e.g. from any thread or ISR to a drain task.
+ *
+ * A producer reserves space by advancing a reservation counter with compare-and-swap, copies its bytes in, then adds
+ * them to a commit counter. Whichever producer commits while no other reservation is outstanding publishes everything
+ * committed so far to the consumer, so writes never wait on each other: a producer preempted between reserving and
+ * committing only delays the bytes reserved after its own until it resumes. Each write() is contiguous in the stream.
+ * Exactly one context may call read().
+ * @tparam N Capacity in bytes; must be a power of two.
+ */
+template <size_t N>
+class MpscByteRing {
+public:
+  static_assert((N > 0) && ((N & (N - 1)) == 0), "MpscByteRing capacity must be a power of two");
+
+  constexpr MpscByteRing() noexcept
+      : _reserved(0)
+      , _committed(0)
+      , _head(0)
+      , _tail(0)
+      , _data{}
+  {
+  }
+
+  MpscByteRing(const MpscByteRing&)            = delete;
+  MpscByteRing& operator=(const MpscByteRing&) = delete;
+
+  /** @brief Returns the number of bytes published to the consumer. Exact for the consumer, a lower bound otherwise. */
+  size_t size() const noexcept
+  {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+
+  constexpr size_t capacity() const noexcept { return N; }
+  bool             empty() const noexcept { return size() == 0; }
+
+  /** @brief Any producer: appends all count bytes, or none of them.
+   * @return Err::RESOURCE_FULL if fewer than count bytes are free.
+   */
+  Err write(const void* data, size_t count) noexcept
+  {
+    auto start = _reserved.load(std::memory_order_relaxed);
+    do
+    {
+      if ((N - (start - _tail.load(std::memory_order_acquire))) < count)
+      {
+        return Err::RESOURCE_FULL;
+      }
+    } while (!_reserved.compare_exchange_weak(start, start + count, std::memory_order_relaxed));
+    detail::ringCopyIn(_data, start, static_cast<const uint8_t*>(data), count);
+
+    // The release pairs with the acquire of whichever producer publishes these bytes
+    const auto committed = _committed.fetch_add(count, std::memory_order_acq_rel) + count;
+    if (committed == _reserved.load(std::memory_order_acquire))
+    {
+      // Every byte before committed is written; a stale publisher must not move the head back
+      auto head = _head.load(std::memory_order_relaxed);
+      while (((committed - head) <= N) && (committed != head) &&
+             !_head.compare_exchange_weak(head, committed, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+    }
+    return Err::NONE;
+  }
+
+  /** @brief Consumer: moves up to count published bytes into out.
+   * @return Number of bytes read.
+   */
+  size_t read(void* out, size_t count) noexcept
+  {
+    const auto tail      = _tail.load(std::memory_order_relaxed);
+    const auto head      = _head.load(std::memory_order_acquire);
+    const auto available = head - tail;
+    const auto taken     = (count < available) ? count : available;
+    detail::ringCopyOut(_data, tail, static_cast<uint8_t*>(out), taken);
+    _tail.store(tail + taken, std::memory_order_release);
+    return taken;
+  }
+
+private:
+  std::atomic<size_t> _reserved;   ///< Total bytes ever reserved by producers.
+  std::atomic<size_t> _committed;  ///< Total bytes producers have finished copying in.
+  std::atomic<size_t> _head;       ///< Total bytes published to the consumer.
+  std::atomic<size_t> _tail;       ///< Total bytes ever read; owned by the consumer.
+  uint8_t             _data[N];
+};
+
+}  // namespace lil
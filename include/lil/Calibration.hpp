@@ -0,0 +1,289 @@
+#pragma once
+
+// std
+#include <limits>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+// local
+#include <lil/Binary.hpp>
+#include <lil/Fixed.hpp>
+#include <lil/Interval.hpp>
+
+namespace lil {
+namespace detail {
+/** @brief Uniform access to the integer representation of integral and Fixed values, and conversion from floating
+ * point, so that calibration math can be written once for every backend.
+ */
+template <typename T, typename = void>
+struct Numeric;
+
+template <typename T>
+struct Numeric<T, std::enable_if_t<std::is_integral<T>::value>> {
+  static constexpr bool   Is_Floating = false;
+  static constexpr size_t Raw_Bits    = Bit_Count_v<T>;
+
+  static constexpr int64_t raw(T value) noexcept { return static_cast<int64_t>(value); }
+
+  static constexpr T fromRaw(int64_t raw) noexcept
+  {
+    constexpr auto lowest = static_cast<int64_t>(std::numeric_limits<T>::lowest());
+    constexpr auto max    = static_cast<int64_t>(minimum(uint64_t(std::numeric_limits<T>::max()), uint64_t(INT64_MAX)));
+    return static_cast<T>(minimum(maximum(raw, lowest), max));
+  }
+
+  template <typename TFloat>
+  static constexpr TFloat toFloating(T value) noexcept
+  {
+    return static_cast<TFloat>(value);
+  }
+
+  template <typename TFloat>
+  static constexpr T fromFloating(TFloat value) noexcept
+  {
+    constexpr auto lowest = static_cast<TFloat>(std::numeric_limits<T>::lowest());
+    constexpr auto max    = static_cast<TFloat>(std::numeric_limits<T>::max());
+    const auto     clamped = minimum(maximum(value, lowest), max);
+    return static_cast<T>(clamped + ((clamped < 0) ? TFloat(-0.5) : TFloat(0.5)));
+  }
+};
+
+template <typename T>
+struct Numeric<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  static constexpr bool Is_Floating = true;
+
+  template <typename TFloat>
+  static constexpr TFloat toFloating(T value) noexcept
+  {
+    return static_cast<TFloat>(value);
+  }
+
+  template <typename TFloat>
+  static constexpr T fromFloating(TFloat value) noexcept
+  {
+    return static_cast<T>(value);
+  }
+};
+
+template <size_t IntBits, size_t FracBits>
+struct Numeric<Fixed<IntBits, FracBits>> {
+  using fixed_type = Fixed<IntBits, FracBits>;
+
+  static constexpr bool   Is_Floating = false;
+  static constexpr size_t Raw_Bits    = IntBits + FracBits;
+
+  static constexpr int64_t raw(fixed_type value) noexcept { return value.raw(); }
+
+  static constexpr fixed_type fromRaw(int64_t raw) noexcept
+  {
+    return fixed_type::fromRaw(static_cast<typename fixed_type::raw_type>(fixed_type::clamp(raw)));
+  }
+
+  template <typename TFloat>
+  static constexpr TFloat toFloating(fixed_type value) noexcept
+  {
+    return static_cast<TFloat>(value.raw()) / static_cast<TFloat>(fixed_type::One_Raw);
+  }
+
+  template <typename TFloat>
+  static constexpr fixed_type fromFloating(TFloat value) noexcept
+  {
+    return fixed_type(value);
+  }
+};
+}  // namespace detail
+
+template <typename TIn, typename TOut>
+class LinearMap;
+
+/** @brief Linearly maps values from an input Interval onto an output Interval, e.g. raw ADC counts onto engineering
+ * units. Inputs are clipped to the input Interval first, so results never leave the output range.
+ *
+ * The slope is computed once at construction, so evaluation is a subtract, a multiply and an add, with no division:
+ * - If either type is floating point, the slope is stored in that type.
+ * - Otherwise (integral and Fixed types), the slope is a 64 bit integer scaled by 2^Shift, where Shift is chosen from
+ *   the output width so that the product cannot overflow; results are rounded to nearest.
+ */
+template <typename In, typename Out>
+class LinearMap<Interval<In>, Interval<Out>> final {
+  using in_numeric  = detail::Numeric<In>;
+  using out_numeric = detail::Numeric<Out>;
+
+public:
+  static constexpr bool Is_Floating = in_numeric::Is_Floating || out_numeric::Is_Floating;
+  using slope_type = std::conditional_t<Is_Floating, std::conditional_t<out_numeric::Is_Floating, Out, In>, int64_t>;
+
+  /** @brief Constructs a map that always returns a default constructed Out. */
+  constexpr LinearMap() noexcept
+      : _in()
+      , _origin()
+      , _slope()
+  {
+  }
+
+  /** @brief Maps in.min onto out.min and in.max onto out.max. */
+  constexpr LinearMap(const Interval<In>& in, const Interval<Out>& out) noexcept
+      : LinearMap(in.min, out.min, in.max, out.max)
+  {
+  }
+
+  /** @brief Maps x0 onto y0 and x1 onto y1. Unlike the Interval overload, y1 may be less than y0.
+   * @pre x0 != x1
+   */
+  constexpr LinearMap(In x0, Out y0, In x1, Out y1) noexcept
+      : _in(x0, x1)
+      , _origin(originOf(x0, y0, x1, y1))
+      , _slope(slopeOf(x0, y0, x1, y1))
+  {
+  }
+
+  /** @brief Returns the input Interval that inputs are clipped to. */
+  constexpr const Interval<In>& input() const noexcept { return _in; }
+
+  /** @brief Maps a single value. */
+  constexpr Out operator()(In x) const noexcept
+  {
+    const auto clipped = _in.clip(x);
+    if constexpr (Is_Floating)
+    {
+      const auto dx = in_numeric::template toFloating<slope_type>(clipped) -
+                      in_numeric::template toFloating<slope_type>(_in.min);
+      return out_numeric::fromFloating(_origin + (dx * _slope));
+    }
+    else
+    {
+      const auto dx = in_numeric::raw(clipped) - in_numeric::raw(_in.min);
+      return out_numeric::fromRaw(_origin + (((dx * _slope) + Half) >> Shift));
+    }
+  }
+
+  /** @brief Maps count values from in to out. The loop has no branches or divisions so it can auto-vectorize. */
+  void operator()(const In* in, Out* out, size_t count) const noexcept
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      out[i] = (*this)(in[i]);
+    }
+  }
+
+private:
+  template <bool Floating, typename = void>
+  struct Scale {
+    static constexpr size_t  Shift = 0;
+    static constexpr int64_t Half  = 0;
+  };
+
+  template <typename Unused>
+  struct Scale<false, Unused> {
+    static_assert(out_numeric::Raw_Bits <= 32, "Integer slopes need headroom above the output width");
+    static constexpr size_t  Shift = 61 - out_numeric::Raw_Bits;
+    static constexpr int64_t Half  = int64_t(1) << (Shift - 1);
+  };
+
+  using origin_type = std::conditional_t<Is_Floating, slope_type, int64_t>;
+
+  static constexpr size_t  Shift = Scale<Is_Floating>::Shift;  ///< Fractional bits of an integer slope.
+  static constexpr int64_t Half  = Scale<Is_Floating>::Half;   ///< Rounds integer results to nearest.
+
+  Interval<In> _in;
+  origin_type  _origin;  ///< Output at _in.min.
+  slope_type   _slope;   ///< Output units per input unit.
+
+  static constexpr origin_type originOf(In x0, Out y0, In x1, Out y1) noexcept
+  {
+    const auto y_at_min = (x1 < x0) ? y1 : y0;
+    if constexpr (Is_Floating)
+    {
+      return out_numeric::template toFloating<slope_type>(y_at_min);
+    }
+    else
+    {
+      return out_numeric::raw(y_at_min);
+    }
+  }
+
+  static constexpr slope_type slopeOf(In x0, Out y0, In x1, Out y1) noexcept
+  {
+    if constexpr (Is_Floating)
+    {
+      const auto dy = out_numeric::template toFloating<slope_type>(y1) - out_numeric::template toFloating<slope_type>(y0);
+      const auto dx = in_numeric::template toFloating<slope_type>(x1) - in_numeric::template toFloating<slope_type>(x0);
+      return dy / dx;
+    }
+    else
+    {
+      const auto dy = out_numeric::raw(y1) - out_numeric::raw(y0);
+      const auto dx = in_numeric::raw(x1) - in_numeric::raw(x0);
+      return (dy * (int64_t(1) << Shift)) / dx;
+    }
+  }
+};
+
+/** @brief Interpolates over a calibration table of N (x, y) breakpoints.
+ *
+ * Each segment is a precomputed LinearMap, so evaluation never divides. The segment is found with a branchless binary
+ * search whose trip count is fixed by N, which compiles to conditional moves and keeps batch evaluation free of
+ * mispredictions. Inputs outside the table are clipped to its first and last breakpoints.
+ * @tparam N Number of breakpoints; at least 2.
+ * @tparam TIn Input type, e.g. uint16_t ADC counts, float or Fixed.
+ * @tparam TOut Output type, e.g. float or Fixed.
+ */
+template <size_t N, typename TIn = float, typename TOut = TIn>
+class PiecewiseLinear final {
+public:
+  static_assert(N >= 2, "PiecewiseLinear needs at least one segment");
+  using segment_type = LinearMap<Interval<TIn>, Interval<TOut>>;
+
+  /** @brief Constructs the table from breakpoints.
+   * @pre xs is strictly increasing. ys may be in any order.
+   */
+  constexpr PiecewiseLinear(const TIn (&xs)[N], const TOut (&ys)[N]) noexcept
+      : _xs{}
+      , _segments{}
+  {
+    for (size_t i = 0; i < N; ++i)
+    {
+      _xs[i] = xs[i];
+    }
+    for (size_t i = 0; i < (N - 1); ++i)
+    {
+      _segments[i] = segment_type(xs[i], ys[i], xs[i + 1], ys[i + 1]);
+    }
+  }
+
+  /** @brief Interpolates a single value. */
+  constexpr TOut operator()(TIn x) const noexcept
+  {
+    return _segments[segment(x)](x);
+  }
+
+  /** @brief Interpolates count values from in to out. */
+  void operator()(const TIn* in, TOut* out, size_t count) const noexcept
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      out[i] = (*this)(in[i]);
+    }
+  }
+
+  /** @brief Returns the index of the segment that x falls in, in [0, N - 2]. */
+  constexpr size_t segment(TIn x) const noexcept
+  {
+    size_t base   = 0;
+    size_t length = N - 1;
+    while (length > 1)
+    {
+      const auto half = length / 2;
+      base += (_xs[base + half] <= x) ? half : 0;
+      length -= half;
+    }
+    return base;
+  }
+
+private:
+  TIn          _xs[N];
+  segment_type _segments[N - 1];
+};
+
+}  // namespace lil
@@ -0,0 +1,65 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/detail/LilConf.h>
+
+/** @file
+ * Runtime CPU feature dispatch, so one host binary built for baseline x86-64 still runs each kernel with the widest
+ * instructions the machine has. The CPU is probed once with cpuid, including whether the OS saves the wider registers,
+ * and every kernel resolves its function pointer on first use from a Kernel table of variants, one per CpuLevel.
+ * LIL_CPU_LEVEL caps the level, e.g. to 0 to run only the portable code. Other architectures run the Scalar variants.
+ */
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#  define LIL_CPU_X86 true  ///< Whether kernels may have x86 variants, compiled with target attributes.
+#else
+#  define LIL_CPU_X86 false
+#endif
+
+namespace lil {
+
+/** @brief Instruction set levels kernels are written for; each implies those below it. */
+enum class CpuLevel : uint8_t {
+  Scalar,  ///< Portable C++, the reference every other variant must agree with.
+  Sse42,   ///< SSE4.2, including its CRC32C instruction.
+  Avx2,    ///< AVX2 with the OS saving YMM registers.
+  Avx512,  ///< AVX-512 F and BW with the OS saving ZMM registers.
+};
+
+constexpr size_t Cpu_Levels = 4;
+
+/** @return The highest level this CPU supports. */
+CpuLevel cpuDetected() noexcept;
+
+/** @return The level kernels run at: cpuDetected(), capped by LIL_CPU_LEVEL. */
+CpuLevel cpuLevel() noexcept;
+
+const char* cpuLevelName(CpuLevel level) noexcept;
+
+/** @brief A kernel's variants indexed by CpuLevel, nullptr where it has none; the Scalar variant is required. */
+template <typename Function>
+struct Kernel {
+  Function variants[Cpu_Levels];
+
+  /** @return The variant of the highest level up to level. */
+  constexpr Function at(CpuLevel level) const noexcept
+  {
+    for (auto i = static_cast<size_t>(level); i > 0; --i)
+    {
+      if (variants[i] != nullptr)
+      {
+        return variants[i];
+      }
+    }
+    return variants[0];
+  }
+
+  /** @return The variant cpuLevel() selects. */
+  Function resolve() const noexcept { return at(cpuLevel()); }
+};
+
+}  // namespace lil
@@ -24,7 +24,7 @@ enum Err {
   DATA_CORRUPTED   = 0x00F,  ///< Sentinel or other values do not match expected results, RAM/Flash check failure, etc.
   BAD_ALLOC        = 0x010,  ///< Allocation failed. Out of heap memory, pool/arena exhausted, etc.
   BAD_ALIGN        = 0x011,  ///< Value is not on properly aligned address.
-  ACCESS_VIOLATION = 0x012,  ///< Attempted to access invalid address. E.g. memory mapped region, unwritable memory, wrong I2C address,
+  ACCESS_VIOLATION = 0x012,  ///< Attempted to access invalid address. E.g. memory mapped region, unwritable memory, wrong I2C address, etc.
 
   CHECKSUM = 0x013,  ///< Checksum mismatch. E.g. bus/net protocol, hardware checks, etc.
   PARITY   = 0x014,  ///< Parity check failed.
@@ -46,9 +46,9 @@ enum Err {
   ENDPOINT_UNREACHABLE  = 0x021,  ///< Could not establish a connection.
   COMMUNICATION_DROPPED = 0x022,  ///< A previously successful communication has been terminated.
 
-  HANDSHAKE_FAILED  = 0x023,  ///< Communications OK, but
+  HANDSHAKE_FAILED  = 0x023,  ///< Communications OK, but the peer did not complete the handshake.
   PERMISSION_DENIED = 0x024,  ///< A procedure could not be run due to insufficient permissions.
-  KEY_REJECTED      = 0x025,  ///< Some key was not valid. E.g. invliad key/password/hash/token.
+  KEY_REJECTED      = 0x025,  ///< Some key was not valid. E.g. invalid key/password/hash/token.
   KEY_EXPIRED       = 0x026,  ///< Previously acceptable key/token etc. is no longer valid.
 
   METL_MAX,            ///< Last contiguous enum for currently implemented error codes. Good for an array max, bounds check, etc.
@@ -56,5 +56,11 @@ enum Err {
   ERROR_MAX  = 0x200,  ///< Maximum number of error codes that may ever be allocated.
 };
 
-static const char* ToString(Err err);
+/** @brief Returns the enumerator name of err, e.g. "BAD_ALLOC".
+ * Application codes in [USER_ERROR, ERROR_MAX) return "USER_ERROR"; any other unassigned value returns "INVALID".
+ */
+const char* ToString(Err err) noexcept;
+
+/** @brief Returns a one sentence, human readable description of err. */
+const char* Describe(Err err) noexcept;
 }  // namespace lil
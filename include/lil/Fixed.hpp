@@ -0,0 +1,315 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+// local
+#include <lil/Binary.hpp>
+#include <lil/Err.hpp>
+#include <lil/Interval.hpp>
+
+namespace lil {
+
+/** @brief A signed, saturating Q-format fixed point number for targets without an FPU.
+ *
+ * Fixed<IntBits, FracBits> stores value * 2^FracBits in the smallest integer that holds IntBits + FracBits bits. IntBits
+ * includes the sign bit, so Fixed<16, 16> spans [-32768, 32768) with a resolution of 2^-16. Every operation clamps to
+ * that range instead of wrapping. Operators saturate silently; the named functions additionally report
+ * Err::MATH_OVERFLOW or Err::DIVIDE_BY_ZERO through a sticky Err, so a chain of operations can be checked once.
+ * @tparam IntBits Number of integer bits, including the sign bit.
+ * @tparam FracBits Number of fractional bits.
+ */
+template <size_t IntBits, size_t FracBits>
+class Fixed final {
+public:
+  static_assert(IntBits >= 1, "Fixed needs at least the sign bit");
+  static_assert((IntBits + FracBits) <= 32, "Fixed intermediates must fit in 64 bits");
+
+  using raw_type   = BitsToInt_t<IntBits + FracBits>;        ///< Storage type.
+  using wide_type  = int64_t;                                ///< Holds any intermediate of the scalar operations.
+  using batch_type = BitsToInt_t<2 * (IntBits + FracBits)>;  ///< Narrowest type that holds any sum or product of 2 raw
+                                                             ///< values, which keeps batch loops in the widest lanes.
+
+  static constexpr size_t    Int_Bits  = IntBits;
+  static constexpr size_t    Frac_Bits = FracBits;
+  static constexpr wide_type One_Raw   = wide_type(1) << FracBits;                           ///< Raw value of 1.0.
+  static constexpr wide_type Max_Raw   = (wide_type(1) << (IntBits + FracBits - 1)) - 1;  ///< Greatest raw value.
+  static constexpr wide_type Min_Raw   = -(wide_type(1) << (IntBits + FracBits - 1));     ///< Lowest raw value.
+
+  /** @brief Constructs 0. */
+  constexpr Fixed() noexcept
+      : _raw(0)
+  {
+  }
+
+  /** @brief Constructs the closest representable value to an integer or floating point value, saturating if needed. */
+  template <typename TNum, typename = std::enable_if_t<std::is_arithmetic<TNum>::value>>
+  explicit constexpr Fixed(TNum value) noexcept
+      : _raw(fromNumber(value))
+  {
+  }
+
+  /** @brief Constructs a Fixed directly from its raw representation. */
+  static constexpr Fixed fromRaw(raw_type raw) noexcept
+  {
+    Fixed fixed;
+    fixed._raw = raw;
+    return fixed;
+  }
+
+  static constexpr Fixed max() noexcept { return fromRaw(static_cast<raw_type>(Max_Raw)); }  ///< Greatest value.
+  static constexpr Fixed lowest() noexcept { return fromRaw(static_cast<raw_type>(Min_Raw)); }  ///< Lowest value.
+  static constexpr Fixed epsilon() noexcept { return fromRaw(1); }  ///< Smallest positive value.
+
+  constexpr raw_type raw() const noexcept { return _raw; }  ///< Returns value * 2^FracBits.
+
+  /** @brief Converts to the nearest integer toward negative infinity. */
+  constexpr raw_type toInt() const noexcept { return static_cast<raw_type>(wide_type(_raw) >> FracBits); }
+
+  /** @brief Converts to float. Exact when IntBits + FracBits <= 24. */
+  constexpr float toFloat() const noexcept { return static_cast<float>(_raw) / static_cast<float>(One_Raw); }
+
+  /** @brief Returns *this + rhs, saturating and setting err to Err::MATH_OVERFLOW on overflow. */
+  constexpr Fixed add(Fixed rhs, Err& err) const noexcept
+  {
+    return saturate(wide_type(_raw) + rhs._raw, err);
+  }
+
+  /** @brief Returns *this - rhs, saturating and setting err to Err::MATH_OVERFLOW on overflow. */
+  constexpr Fixed subtract(Fixed rhs, Err& err) const noexcept
+  {
+    return saturate(wide_type(_raw) - rhs._raw, err);
+  }
+
+  /** @brief Returns *this * rhs rounded to nearest, saturating and setting err to Err::MATH_OVERFLOW on overflow. */
+  constexpr Fixed multiply(Fixed rhs, Err& err) const noexcept
+  {
+    return saturate(roundShift(wide_type(_raw) * rhs._raw), err);
+  }
+
+  /** @brief Returns *this / rhs truncated toward zero, saturating and setting err to Err::MATH_OVERFLOW on overflow.
+   * Division by zero saturates toward the sign of *this and sets err to Err::DIVIDE_BY_ZERO.
+   */
+  constexpr Fixed divide(Fixed rhs, Err& err) const noexcept
+  {
+    if (rhs._raw == 0)
+    {
+      err = Err::DIVIDE_BY_ZERO;
+      return (_raw < 0) ? lowest() : ((_raw > 0) ? max() : Fixed{});
+    }
+    return saturate((wide_type(_raw) * One_Raw) / rhs._raw, err);
+  }
+
+  /** @brief Returns -*this, saturating -lowest() to max(). */
+  constexpr Fixed operator-() const noexcept
+  {
+    Err ignored = Err::NONE;
+    return saturate(-wide_type(_raw), ignored);
+  }
+
+  constexpr Fixed operator+(Fixed rhs) const noexcept
+  {
+    Err ignored = Err::NONE;
+    return add(rhs, ignored);
+  }
+
+  constexpr Fixed operator-(Fixed rhs) const noexcept
+  {
+    Err ignored = Err::NONE;
+    return subtract(rhs, ignored);
+  }
+
+  constexpr Fixed operator*(Fixed rhs) const noexcept
+  {
+    Err ignored = Err::NONE;
+    return multiply(rhs, ignored);
+  }
+
+  constexpr Fixed operator/(Fixed rhs) const noexcept
+  {
+    Err ignored = Err::NONE;
+    return divide(rhs, ignored);
+  }
+
+  /** @brief Multiplies by an integer, saturating. */
+  template <typename TInt, typename = std::enable_if_t<std::is_integral<TInt>::value>>
+  constexpr Fixed operator*(TInt rhs) const noexcept
+  {
+    Err ignored = Err::NONE;
+    return saturate(wide_type(_raw) * static_cast<wide_type>(rhs), ignored);
+  }
+
+  /** @brief Divides by an integer, truncating toward zero. Division by zero saturates toward the sign of *this. */
+  template <typename TInt, typename = std::enable_if_t<std::is_integral<TInt>::value>>
+  constexpr Fixed operator/(TInt rhs) const noexcept
+  {
+    Err ignored = Err::NONE;
+    if (rhs == 0)
+    {
+      return divide(Fixed{}, ignored);
+    }
+    return saturate(wide_type(_raw) / static_cast<wide_type>(rhs), ignored);
+  }
+
+  constexpr Fixed& operator+=(Fixed rhs) noexcept { return *this = *this + rhs; }
+  constexpr Fixed& operator-=(Fixed rhs) noexcept { return *this = *this - rhs; }
+  constexpr Fixed& operator*=(Fixed rhs) noexcept { return *this = *this * rhs; }
+  constexpr Fixed& operator/=(Fixed rhs) noexcept { return *this = *this / rhs; }
+
+  constexpr bool operator==(Fixed rhs) const noexcept { return _raw == rhs._raw; }
+  constexpr bool operator!=(Fixed rhs) const noexcept { return _raw != rhs._raw; }
+  constexpr bool operator<(Fixed rhs) const noexcept { return _raw < rhs._raw; }
+  constexpr bool operator>(Fixed rhs) const noexcept { return _raw > rhs._raw; }
+  constexpr bool operator<=(Fixed rhs) const noexcept { return _raw <= rhs._raw; }
+  constexpr bool operator>=(Fixed rhs) const noexcept { return _raw >= rhs._raw; }
+
+  /** @brief Clamps a wide raw value into range, setting err to Err::MATH_OVERFLOW if it was out of range. */
+  static constexpr Fixed saturate(wide_type raw, Err& err) noexcept
+  {
+    if ((raw > Max_Raw) || (raw < Min_Raw))
+    {
+      err = Err::MATH_OVERFLOW;
+    }
+    return fromRaw(static_cast<raw_type>(clamp(raw)));
+  }
+
+  /** @brief Branchless clamp of a wide raw value into [Min_Raw, Max_Raw]. */
+  static constexpr wide_type clamp(wide_type raw) noexcept
+  {
+    return minimum(maximum(raw, Min_Raw), Max_Raw);
+  }
+
+  /** @brief Branchless clamp of a batch raw value into [Min_Raw, Max_Raw]. */
+  static constexpr batch_type clampBatch(batch_type raw) noexcept
+  {
+    return minimum(maximum(raw, static_cast<batch_type>(Min_Raw)), static_cast<batch_type>(Max_Raw));
+  }
+
+  /** @brief Divides a product of 2 raw values by 2^FracBits, rounding half up. */
+  template <typename TWide>
+  static constexpr TWide roundShift(TWide product) noexcept
+  {
+    if constexpr (FracBits == 0)
+    {
+      return product;
+    }
+    else
+    {
+      return (product + (TWide(1) << (FracBits - 1))) >> FracBits;
+    }
+  }
+
+private:
+  raw_type _raw;
+
+  template <typename TNum>
+  static constexpr raw_type fromNumber(TNum value) noexcept
+  {
+    if constexpr (std::is_floating_point<TNum>::value)
+    {
+      const auto scaled = value * static_cast<TNum>(One_Raw);
+      if (!(scaled < static_cast<TNum>(Max_Raw)))
+      {
+        return static_cast<raw_type>(Max_Raw);
+      }
+      if (!(scaled > static_cast<TNum>(Min_Raw)))
+      {
+        return static_cast<raw_type>(Min_Raw);
+      }
+      return static_cast<raw_type>(static_cast<wide_type>(scaled + ((scaled < 0) ? TNum(-0.5) : TNum(0.5))));
+    }
+    else
+    {
+      constexpr auto max_int = Max_Raw >> FracBits;
+      constexpr auto min_int = Min_Raw >> FracBits;
+      if (std::is_unsigned<TNum>::value ? (uint64_t(value) > uint64_t(max_int)) : (wide_type(value) > max_int))
+      {
+        return static_cast<raw_type>(Max_Raw);
+      }
+      if (std::is_signed<TNum>::value && (wide_type(value) < min_int))
+      {
+        return static_cast<raw_type>(Min_Raw);
+      }
+      return static_cast<raw_type>(wide_type(value) * One_Raw);
+    }
+  }
+};
+
+/** @brief Steps Fixed Interval boundaries by the smallest representable amount. */
+template <size_t IntBits, size_t FracBits>
+struct IntervalStep<Fixed<IntBits, FracBits>> {
+  using fixed_type = Fixed<IntBits, FracBits>;
+  using raw_type   = typename fixed_type::raw_type;
+  static constexpr fixed_type next(fixed_type value) noexcept { return fixed_type::fromRaw(static_cast<raw_type>(value.raw() + 1)); }
+  static constexpr fixed_type prev(fixed_type value) noexcept { return fixed_type::fromRaw(static_cast<raw_type>(value.raw() - 1)); }
+};
+
+/** @brief Computes out[i] = lhs[i] + rhs[i] for count elements. Branchless so the loop auto-vectorizes.
+ * @return Err::MATH_OVERFLOW if any element saturated, else Err::NONE.
+ */
+template <size_t IntBits, size_t FracBits>
+Err add(const Fixed<IntBits, FracBits>* lhs,
+        const Fixed<IntBits, FracBits>* rhs,
+        Fixed<IntBits, FracBits>*       out,
+        size_t                          count) noexcept
+{
+  using fixed_type = Fixed<IntBits, FracBits>;
+  using batch_type = typename fixed_type::batch_type;
+  bool saturated   = false;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const auto sum     = static_cast<batch_type>(batch_type(lhs[i].raw()) + rhs[i].raw());
+    const auto clamped = fixed_type::clampBatch(sum);
+    saturated |= (sum != clamped);
+    out[i] = fixed_type::fromRaw(static_cast<typename fixed_type::raw_type>(clamped));
+  }
+  return saturated ? Err::MATH_OVERFLOW : Err::NONE;
+}
+
+/** @brief Computes out[i] = lhs[i] - rhs[i] for count elements. Branchless so the loop auto-vectorizes.
+ * @return Err::MATH_OVERFLOW if any element saturated, else Err::NONE.
+ */
+template <size_t IntBits, size_t FracBits>
+Err subtract(const Fixed<IntBits, FracBits>* lhs,
+             const Fixed<IntBits, FracBits>* rhs,
+             Fixed<IntBits, FracBits>*       out,
+             size_t                          count) noexcept
+{
+  using fixed_type = Fixed<IntBits, FracBits>;
+  using batch_type = typename fixed_type::batch_type;
+  bool saturated   = false;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const auto difference = static_cast<batch_type>(batch_type(lhs[i].raw()) - rhs[i].raw());
+    const auto clamped    = fixed_type::clampBatch(difference);
+    saturated |= (difference != clamped);
+    out[i] = fixed_type::fromRaw(static_cast<typename fixed_type::raw_type>(clamped));
+  }
+  return saturated ? Err::MATH_OVERFLOW : Err::NONE;
+}
+
+/** @brief Computes out[i] = lhs[i] * rhs[i] for count elements. Branchless so the loop auto-vectorizes.
+ * @return Err::MATH_OVERFLOW if any element saturated, else Err::NONE.
+ */
+template <size_t IntBits, size_t FracBits>
+Err multiply(const Fixed<IntBits, FracBits>* lhs,
+             const Fixed<IntBits, FracBits>* rhs,
+             Fixed<IntBits, FracBits>*       out,
+             size_t                          count) noexcept
+{
+  using fixed_type = Fixed<IntBits, FracBits>;
+  using batch_type = typename fixed_type::batch_type;
+  bool saturated   = false;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const auto product = fixed_type::roundShift(static_cast<batch_type>(batch_type(lhs[i].raw()) * rhs[i].raw()));
+    const auto clamped = fixed_type::clampBatch(product);
+    saturated |= (product != clamped);
+    out[i] = fixed_type::fromRaw(static_cast<typename fixed_type::raw_type>(clamped));
+  }
+  return saturated ? Err::MATH_OVERFLOW : Err::NONE;
+}
+
+}  // namespace lil
@@ -0,0 +1,295 @@
+#pragma once
+
+// std
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+// local
+#include <lil/Err.hpp>
+#include <lil/Result.hpp>
+
+namespace lil {
+
+/** @brief Identifies an element of a FixedPriorityQueue; stays unique after the element is popped or erased. */
+struct HeapHandle {
+  uint32_t slot;
+  uint32_t generation;
+
+  constexpr bool operator==(const HeapHandle& other) const noexcept
+  {
+    return (slot == other.slot) && (generation == other.generation);
+  }
+};
+
+namespace detail {
+template <typename T, bool Indexed>
+struct HeapEntry {
+  T value;
+};
+
+template <typename T>
+struct HeapEntry<T, true> {
+  T        value;
+  uint32_t slot = 0;  ///< The handle slot whose position must follow this entry around the heap.
+};
+}  // namespace detail
+
+/** @brief A priority queue of at most N elements stored inline as a D-ary heap, so it never allocates.
+ *
+ * Like std::priority_queue, top() is the element that compares greatest, e.g. pass std::greater for a min-queue of
+ * deadlines. Wider heaps are shallower, so push() does fewer comparisons, while pop() compares D children per level;
+ * the children of a node are adjacent, so for small elements a level costs about one cache line. D = 4 is usually the
+ * best trade-off.
+ *
+ * When Indexed, push() returns a handle that update() and erase() use to find the element in O(1) and then restore
+ * the heap in O(log n), instead of lazily skipping stale entries. The index is a position per slot, kept current as
+ * elements move; pass Indexed = false to drop it when only push() and pop() are needed.
+ * @tparam T A default constructible element type.
+ * @tparam N Capacity.
+ * @tparam Compare Strict weak ordering; top() is an element that no other compares greater than.
+ * @tparam D Heap arity.
+ * @tparam Indexed Whether to keep the index behind handles.
+ */
+template <typename T, size_t N, typename Compare = std::less<T>, size_t D = 4, bool Indexed = true>
+class FixedPriorityQueue {
+public:
+  static_assert((N > 0) && (N < UINT32_MAX), "FixedPriorityQueue capacity must fit a 32 bit index");
+  static_assert(D >= 2, "FixedPriorityQueue arity must be at least 2");
+
+  using value_type  = T;
+  using push_result = std::conditional_t<Indexed, Result<HeapHandle>, Err>;
+
+  explicit FixedPriorityQueue(Compare compare = Compare()) noexcept
+      : _compare(compare)
+  {
+    if constexpr (Indexed)
+    {
+      for (uint32_t i = 0; i < N; ++i)
+      {
+        _slots[i].position   = i + 1;
+        _slots[i].generation = 0;
+      }
+    }
+  }
+
+  FixedPriorityQueue(const FixedPriorityQueue&)            = delete;
+  FixedPriorityQueue& operator=(const FixedPriorityQueue&) = delete;
+
+  /** @brief Inserts value in O(log n).
+   * @return The element's handle if Indexed, or Err::RESOURCE_FULL if N elements are queued.
+   */
+  push_result push(const T& value) noexcept
+  {
+    if (_size == N)
+    {
+      return RESOURCE_FULL;
+    }
+    Entry entry{ value };
+    if constexpr (Indexed)
+    {
+      entry.slot = _free;
+      _free      = _slots[entry.slot].position;
+    }
+    siftUp(_size++, entry);
+    if constexpr (Indexed)
+    {
+      return HeapHandle{ entry.slot, _slots[entry.slot].generation };
+    }
+    else
+    {
+      return NONE;
+    }
+  }
+
+  /** @pre !empty() */
+  const T& top() const noexcept { return _heap[0].value; }
+
+  /** @brief Removes top() in O(D log n).
+   * @return Err::RESOURCE_EMPTY if there was nothing to remove.
+   */
+  Err pop() noexcept
+  {
+    if (_size == 0)
+    {
+      return RESOURCE_EMPTY;
+    }
+    removeAt(0);
+    return NONE;
+  }
+
+  /** @brief Returns the handle of top(). @pre !empty() */
+  HeapHandle topHandle() const noexcept
+  {
+    static_assert(Indexed, "Handles require an Indexed FixedPriorityQueue");
+    return { _heap[0].slot, _slots[_heap[0].slot].generation };
+  }
+
+  /** @brief Returns whether handle refers to an element still queued. */
+  bool contains(HeapHandle handle) const noexcept
+  {
+    static_assert(Indexed, "Handles require an Indexed FixedPriorityQueue");
+    return (handle.slot < N) && (_slots[handle.slot].generation == handle.generation) &&
+           (_slots[handle.slot].position < _size) && (_heap[_slots[handle.slot].position].slot == handle.slot);
+  }
+
+  /** @return The queued element handle refers to, or Err::INVALID_ARGUMENT if it was popped or erased. */
+  Result<const T*> find(HeapHandle handle) const noexcept
+  {
+    if (!contains(handle))
+    {
+      return INVALID_ARGUMENT;
+    }
+    return &_heap[_slots[handle.slot].position].value;
+  }
+
+  /** @brief Replaces an element's value, e.g. to decrease a key, moving it up or down in O(log n).
+   * @return Err::INVALID_ARGUMENT if handle's element was popped or erased.
+   */
+  Err update(HeapHandle handle, const T& value) noexcept
+  {
+    if (!contains(handle))
+    {
+      return INVALID_ARGUMENT;
+    }
+    const auto position = _slots[handle.slot].position;
+    const bool raised   = _compare(_heap[position].value, value);
+    Entry      entry{ value, handle.slot };
+    if (raised)
+    {
+      siftUp(position, entry);
+    }
+    else
+    {
+      siftDown(position, entry);
+    }
+    return NONE;
+  }
+
+  /** @brief Removes an element in O(log n).
+   * @return Err::INVALID_ARGUMENT if handle's element was already popped or erased.
+   */
+  Err erase(HeapHandle handle) noexcept
+  {
+    if (!contains(handle))
+    {
+      return INVALID_ARGUMENT;
+    }
+    removeAt(_slots[handle.slot].position);
+    return NONE;
+  }
+
+  void clear() noexcept
+  {
+    while (_size > 0)
+    {
+      removeAt(_size - 1);
+    }
+  }
+
+  size_t           size() const noexcept { return _size; }
+  bool             empty() const noexcept { return _size == 0; }
+  constexpr size_t capacity() const noexcept { return N; }
+
+private:
+  using Entry = detail::HeapEntry<T, Indexed>;
+
+  struct Slot {
+    uint32_t position;  ///< Index into the heap while queued; the next free slot otherwise.
+    uint32_t generation;
+  };
+
+  struct NoSlots {};
+
+  using Slots = std::conditional_t<Indexed, Slot[N], NoSlots>;
+
+  Entry                         _heap[N];
+  [[no_unique_address]] Slots   _slots;
+  [[no_unique_address]] Compare _compare;
+  uint32_t                      _size = 0;
+  uint32_t                      _free = 0;  ///< Head of the list of unused slots, linked through their positions.
+
+  void place(uint32_t position, Entry& entry) noexcept
+  {
+    _heap[position] = std::move(entry);
+    if constexpr (Indexed)
+    {
+      _slots[_heap[position].slot].position = position;
+    }
+  }
+
+  /** @brief Moves entry into the hole at position, shifting ancestors that compare less down into it. */
+  void siftUp(uint32_t position, Entry& entry) noexcept
+  {
+    while (position > 0)
+    {
+      const auto parent = (position - 1) / D;
+      if (!_compare(_heap[parent].value, entry.value))
+      {
+        break;
+      }
+      place(position, _heap[parent]);
+      position = parent;
+    }
+    place(position, entry);
+  }
+
+  /** @brief Moves entry into the hole at position, shifting the greatest descendants up into it. */
+  void siftDown(uint32_t position, Entry& entry) noexcept
+  {
+    for (;;)
+    {
+      const auto first = (position * D) + 1;
+      if (first >= _size)
+      {
+        break;
+      }
+      const auto last = ((first + D) < _size) ? (first + D) : _size;
+      auto       best = first;
+      for (auto child = first + 1; child < last; ++child)
+      {
+        if (_compare(_heap[best].value, _heap[child].value))
+        {
+          best = child;
+        }
+      }
+      if (!_compare(entry.value, _heap[best].value))
+      {
+        break;
+      }
+      place(position, _heap[best]);
+      position = best;
+    }
+    place(position, entry);
+  }
+
+  void removeAt(uint32_t position) noexcept
+  {
+    if constexpr (Indexed)
+    {
+      const auto slot = _heap[position].slot;
+      ++_slots[slot].generation;
+      _slots[slot].position = _free;
+      _free                 = slot;
+    }
+    --_size;
+    if (position == _size)
+    {
+      return;
+    }
+    // Fill the hole with the last entry, which may belong above or below it
+    Entry last = std::move(_heap[_size]);
+    if ((position > 0) && _compare(_heap[(position - 1) / D].value, last.value))
+    {
+      siftUp(position, last);
+    }
+    else
+    {
+      siftDown(position, last);
+    }
+  }
+};
+
+}  // namespace lil
@@ -0,0 +1,59 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+// local
+#include <lil/Cpu.hpp>
+
+namespace lil {
+
+constexpr uint32_t Fnv1a_Basis = 0x811C9DC5U;  ///< FNV-1a 32 bit offset basis.
+constexpr uint32_t Fnv1a_Prime = 0x01000193U;  ///< FNV-1a 32 bit prime.
+constexpr uint32_t Crc32c_Poly = 0x82F63B78U;  ///< CRC-32C (Castagnoli) polynomial, reflected.
+
+/** @brief Hashes size bytes with 32 bit FNV-1a. Usable at compile time, e.g. to turn string literals into IDs.
+ * @param seed Pass a previous result to hash discontiguous data as if it were contiguous.
+ */
+constexpr uint32_t fnv1a(const char* data, size_t size, uint32_t seed = Fnv1a_Basis) noexcept
+{
+  uint32_t hash = seed;
+  for (size_t i = 0; i < size; ++i)
+  {
+    hash = (hash ^ static_cast<uint8_t>(data[i])) * Fnv1a_Prime;
+  }
+  return hash;
+}
+
+namespace detail {
+using Crc32cFunction = uint32_t (*)(const char* data, size_t size, uint32_t seed) noexcept;
+
+extern const Kernel<Crc32cFunction> Crc32c_Kernel;
+
+uint32_t crc32c(const char* data, size_t size, uint32_t seed) noexcept;
+}  // namespace detail
+
+/** @brief Checksums size bytes with CRC-32C, using the SSE4.2 instruction where the CPU has it.
+ * @param seed Pass a previous result to checksum discontiguous data as if it were contiguous.
+ */
+constexpr uint32_t crc32c(const char* data, size_t size, uint32_t seed = 0) noexcept
+{
+  if (!std::is_constant_evaluated())
+  {
+    return detail::crc32c(data, size, seed);
+  }
+  uint32_t crc = ~seed;
+  for (size_t i = 0; i < size; ++i)
+  {
+    crc ^= static_cast<uint8_t>(data[i]);
+    for (int bit = 0; bit < 8; ++bit)
+    {
+      crc = (crc >> 1) ^ (Crc32c_Poly & (0U - (crc & 1U)));
+    }
+  }
+  return ~crc;
+}
+
+}  // namespace lil
@@ -1,6 +1,24 @@
 #pragma once
 
+// std
+#include <math.h>
+#include <type_traits>
+
 namespace lil {
+/** @brief Returns the lesser of 2 values; rhs is returned in case of tie. */
+template <typename T>
+static constexpr T minimum(T lhs, T rhs)
+{
+  return lhs < rhs ? lhs : rhs;
+}
+
+/** @brief Returns the greater of 2 values; rhs is returned in case of tie. */
+template <typename T>
+static constexpr T maximum(T lhs, T rhs)
+{
+  return lhs > rhs ? lhs : rhs;
+}
+
 /** @brief A pair of values that represents a contiguous, inclusive range.
  * @tparam A literal type that supports noexcept default ctor, copy ctor, and operators <, ==, +, -, and /.
  */
@@ -60,10 +78,21 @@ class Interval final {
     return deadband(value, mid());
   }
 
-  /** @brief Returns the midpoint of the Interval. */
+  /** @brief Returns the midpoint of the Interval, rounded like (min + max) / 2 but without overflowing or saturating T
+   * when the bounds sum past its range.
+   */
   constexpr T mid() const noexcept
   {
-    return (min + max) / 2;
+    const T zero = T();
+    if (max < zero)
+    {
+      return max - ((max - min) / 2);
+    }
+    if (!(min < zero))
+    {
+      return min + ((max - min) / 2);
+    }
+    return (min + max) / 2;  // Bounds of opposite signs cannot overflow
   }
 
   /** @brief Returns the difference between max and min. min + length() == max. */
@@ -74,6 +103,7 @@ class Interval final {
 
   /** @brief Constructs an Interval that accepts values that would only be accepted in both lhs and rhs. Inner join.
    * @warning If lhs and rhs do not overlap, the returned Interval spans the 2 inner boundaries, e.g. ([1, 2], [3, 4]) -> [2, 3].
+   * Use IntervalSet to represent disjoint ranges correctly.
    */
   static constexpr Interval intersect(const Interval& lhs, const Interval& rhs) noexcept
   {
@@ -84,6 +114,7 @@ class Interval final {
 
   /** @brief Constructs an Interval that accepts any value that would only be accepted in either lhs and rhs. Full outer join.
    * @warning If lhs and rhs do not overlap, the returned Interval spans the 2 outer boundaries, e.g. ([1, 2], [3, 4]) -> [1, 4].
+   * Use IntervalSet to represent disjoint ranges correctly.
    */
   static constexpr Interval uunion(const Interval& lhs, const Interval& rhs) noexcept
   {
@@ -93,30 +124,34 @@ class Interval final {
   }
 
   /** @brief Checks if the two Intervals are equivalent. */
-  bool operator==(const Interval& other) const noexcept
+  constexpr bool operator==(const Interval& other) const noexcept
   {
     return (min == other.min) && (max == other.max);
   }
 
   /** @brief Checks if the two Intervals are not equivalent. */
-  bool operator!=(const Interval& other) const noexcept
+  constexpr bool operator!=(const Interval& other) const noexcept
   {
     return !(*this == other);
   }
 };
 
-/** @brief Returns the lesser of 2 values; rhs is returned in case of tie. */
+/** @brief Describes how to step to the neighbouring representable values of T. Used to coalesce adjacent Intervals and
+ * to open up inclusive boundaries when subtracting. Specialize for custom numeric types.
+ */
+template <typename T, typename = void>
+struct IntervalStep;
+
 template <typename T>
-static constexpr T minimum(T lhs, T rhs)
-{
-  return lhs < rhs ? lhs : rhs;
-}
+struct IntervalStep<T, std::enable_if_t<std::is_integral<T>::value>> {
+  static constexpr T next(T value) noexcept { return static_cast<T>(value + 1); }  ///< @pre value is not the maximum.
+  static constexpr T prev(T value) noexcept { return static_cast<T>(value - 1); }  ///< @pre value is not the lowest.
+};
 
-/** @brief Returns the greater of 2 values; rhs is returned in case of tie. */
 template <typename T>
-static constexpr T maximum(T lhs, T rhs)
-{
-  return lhs > rhs ? lhs : rhs;
-}
+struct IntervalStep<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  static T next(T value) noexcept { return nextafter(value, static_cast<T>(INFINITY)); }
+  static T prev(T value) noexcept { return nextafter(value, -static_cast<T>(INFINITY)); }
+};
 
 }  // namespace lil
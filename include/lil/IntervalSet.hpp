@@ -0,0 +1,303 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/Err.hpp>
+#include <lil/Interval.hpp>
+#include <lil/detail/IArr.hpp>
+
+namespace lil {
+
+/** @brief A sorted, coalescing set of up to N disjoint Intervals stored in a flat inline array.
+ *
+ * Overlapping or adjacent Intervals are merged on insertion, so [1, 2] + [3, 4] is stored as [1, 4] for integral T.
+ * Membership is a binary search over the Interval minimums; set operations are linear merges.
+ * @tparam T Same requirements as Interval, with an IntervalStep specialization.
+ * @tparam N Maximum number of disjoint Intervals that may be stored.
+ */
+template <typename T, size_t N>
+class IntervalSet : public IArr<IntervalSet<T, N>, const Interval<T>> {
+  Interval<T> _data[N];
+  size_t      _size;
+
+public:
+  using step_type = IntervalStep<T>;
+
+  /** @brief Constructs an empty set. */
+  constexpr IntervalSet() noexcept
+      : _data{}
+      , _size(0)
+  {
+  }
+
+  constexpr const Interval<T>* data() const noexcept { return &_data[0]; }
+  constexpr size_t             size() const noexcept { return _size; }
+  constexpr size_t             capacity() const noexcept { return N; }
+  constexpr size_t             max_size() const noexcept { return N; }
+  constexpr bool               full() const noexcept { return _size == N; }
+  constexpr void               clear() noexcept { _size = 0; }
+
+  /** @brief Determines if value is within any Interval in the set. O(log n). */
+  constexpr bool contains(T value) const noexcept
+  {
+    const auto index = upperBound(value);
+    return (index > 0) && !(_data[index - 1].max < value);
+  }
+
+  /** @brief Determines if every value in interval is within a single Interval of the set. O(log n). */
+  constexpr bool contains(const Interval<T>& interval) const noexcept
+  {
+    const auto index = upperBound(interval.min);
+    return (index > 0) && !(_data[index - 1].max < interval.max);
+  }
+
+  /** @brief Determines if any value in interval is within the set. O(log n). */
+  constexpr bool overlaps(const Interval<T>& interval) const noexcept
+  {
+    const auto index = upperBound(interval.max);
+    return (index > 0) && !(_data[index - 1].max < interval.min);
+  }
+
+  /** @brief Adds all values in interval to the set, merging any Intervals it overlaps or touches.
+   * @return Err::RESOURCE_FULL if interval would need a new slot in a full set. The set is unmodified in that case.
+   */
+  constexpr Err insert(const Interval<T>& interval) noexcept
+  {
+    // first: first stored Interval that overlaps or touches interval; last: one past the final such Interval
+    size_t first = upperBound(interval.min);
+    if ((first > 0) && touches(_data[first - 1], interval))
+    {
+      --first;
+    }
+    size_t last = first;
+    while ((last < _size) && touches(interval, _data[last]))
+    {
+      ++last;
+    }
+
+    if (first == last)
+    {
+      if (full())
+      {
+        return Err::RESOURCE_FULL;
+      }
+      shift(first, +1);
+      _data[first] = interval;
+      return Err::NONE;
+    }
+
+    const auto merged = Interval<T>::uunion(Interval<T>::uunion(_data[first], _data[last - 1]), interval);
+    _data[first]      = merged;
+    shift(last, -static_cast<ptrdiff_t>(last - first - 1));
+    return Err::NONE;
+  }
+
+  /** @brief Removes all values in interval from the set, splitting any Interval that strictly contains it.
+   * @return Err::RESOURCE_FULL if splitting an Interval would overflow a full set. The set is unmodified in that case.
+   */
+  constexpr Err erase(const Interval<T>& interval) noexcept
+  {
+    size_t first = upperBound(interval.min);
+    if ((first > 0) && !(_data[first - 1].max < interval.min))
+    {
+      --first;
+    }
+    size_t last = first;
+    while ((last < _size) && !(interval.max < _data[last].min))
+    {
+      ++last;
+    }
+    if (first == last)
+    {
+      return Err::NONE;
+    }
+
+    const bool keep_head = _data[first].min < interval.min;
+    const bool keep_tail = interval.max < _data[last - 1].max;
+    const auto head      = Interval<T>{ _data[first].min, keep_head ? step_type::prev(interval.min) : interval.min };
+    const auto tail      = Interval<T>{ keep_tail ? step_type::next(interval.max) : interval.max, _data[last - 1].max };
+    const auto kept      = static_cast<size_t>(keep_head) + static_cast<size_t>(keep_tail);
+    const auto removed   = last - first;
+
+    if ((kept > removed) && full())
+    {
+      return Err::RESOURCE_FULL;
+    }
+    shift(last, static_cast<ptrdiff_t>(kept) - static_cast<ptrdiff_t>(removed));
+    size_t out = first;
+    if (keep_head)
+    {
+      _data[out++] = head;
+    }
+    if (keep_tail)
+    {
+      _data[out] = tail;
+    }
+    return Err::NONE;
+  }
+
+  /** @brief Constructs the set of values accepted by either lhs or rhs into out. O(n + m).
+   * @return Err::RESOURCE_FULL if out cannot hold the result; out holds the lowest Intervals that fit.
+   * @pre out is neither lhs nor rhs.
+   */
+  template <size_t L, size_t R>
+  static constexpr Err uunion(const IntervalSet<T, L>& lhs, const IntervalSet<T, R>& rhs, IntervalSet& out) noexcept
+  {
+    out.clear();
+    size_t i = 0;
+    size_t j = 0;
+    while ((i < lhs.size()) || (j < rhs.size()))
+    {
+      const bool take_lhs  = (j == rhs.size()) || ((i < lhs.size()) && (lhs[i].min < rhs[j].min));
+      const auto candidate = take_lhs ? lhs[i++] : rhs[j++];
+      if ((out._size > 0) && touches(out._data[out._size - 1], candidate))
+      {
+        out._data[out._size - 1] = Interval<T>::uunion(out._data[out._size - 1], candidate);
+      }
+      else if (out.push_back(candidate) != Err::NONE)
+      {
+        return Err::RESOURCE_FULL;
+      }
+    }
+    return Err::NONE;
+  }
+
+  /** @brief Constructs the set of values accepted by both lhs and rhs into out. O(n + m).
+   * @return Err::RESOURCE_FULL if out cannot hold the result; out holds the lowest Intervals that fit.
+   * @pre out is neither lhs nor rhs.
+   */
+  template <size_t L, size_t R>
+  static constexpr Err intersect(const IntervalSet<T, L>& lhs, const IntervalSet<T, R>& rhs, IntervalSet& out) noexcept
+  {
+    out.clear();
+    size_t i = 0;
+    size_t j = 0;
+    while ((i < lhs.size()) && (j < rhs.size()))
+    {
+      if (!(lhs[i].max < rhs[j].min) && !(rhs[j].max < lhs[i].min))
+      {
+        if (out.push_back(Interval<T>::intersect(lhs[i], rhs[j])) != Err::NONE)
+        {
+          return Err::RESOURCE_FULL;
+        }
+      }
+      if (lhs[i].max < rhs[j].max)
+      {
+        ++i;
+      }
+      else
+      {
+        ++j;
+      }
+    }
+    return Err::NONE;
+  }
+
+  /** @brief Constructs the set of values accepted by lhs but not rhs into out. O(n + m).
+   * @return Err::RESOURCE_FULL if out cannot hold the result; out holds the lowest Intervals that fit.
+   * @pre out is neither lhs nor rhs.
+   */
+  template <size_t L, size_t R>
+  static constexpr Err difference(const IntervalSet<T, L>& lhs, const IntervalSet<T, R>& rhs, IntervalSet& out) noexcept
+  {
+    out.clear();
+    size_t j = 0;
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+      auto remaining = lhs[i];
+      bool empty     = false;
+      while ((j < rhs.size()) && (rhs[j].max < remaining.min))
+      {
+        ++j;
+      }
+      for (size_t k = j; (k < rhs.size()) && !(remaining.max < rhs[k].min); ++k)
+      {
+        if (remaining.min < rhs[k].min)
+        {
+          if (out.push_back(Interval<T>{ remaining.min, step_type::prev(rhs[k].min) }) != Err::NONE)
+          {
+            return Err::RESOURCE_FULL;
+          }
+        }
+        if (!(rhs[k].max < remaining.max))
+        {
+          empty = true;
+          break;
+        }
+        remaining.min = step_type::next(rhs[k].max);
+      }
+      if (!empty && (out.push_back(remaining) != Err::NONE))
+      {
+        return Err::RESOURCE_FULL;
+      }
+    }
+    return Err::NONE;
+  }
+
+private:
+  /** @brief Index of the first stored Interval whose min is greater than value. */
+  constexpr size_t upperBound(T value) const noexcept
+  {
+    size_t first = 0;
+    size_t count = _size;
+    while (count > 0)
+    {
+      const auto half = count / 2;
+      if (value < _data[first + half].min)
+      {
+        count = half;
+      }
+      else
+      {
+        first += half + 1;
+        count -= half + 1;
+      }
+    }
+    return first;
+  }
+
+  /** @brief Determines if hi can be merged into lo without accepting extra values. @pre !(hi.min < lo.min) */
+  static constexpr bool touches(const Interval<T>& lo, const Interval<T>& hi) noexcept
+  {
+    return !(lo.max < hi.min) || (step_type::next(lo.max) == hi.min);
+  }
+
+  /** @brief Appends interval, which must sort after and not touch the final Interval. */
+  constexpr Err push_back(const Interval<T>& interval) noexcept
+  {
+    if (full())
+    {
+      return Err::RESOURCE_FULL;
+    }
+    _data[_size++] = interval;
+    return Err::NONE;
+  }
+
+  /** @brief Moves elements [from, size()) by distance slots and adjusts the size accordingly. */
+  constexpr void shift(size_t from, ptrdiff_t distance) noexcept
+  {
+    if (distance > 0)
+    {
+      for (size_t i = _size; i-- > from;)
+      {
+        _data[i + distance] = _data[i];
+      }
+    }
+    else if (distance < 0)
+    {
+      for (size_t i = from; i < _size; ++i)
+      {
+        _data[i + distance] = _data[i];
+      }
+    }
+    _size += distance;
+  }
+
+  template <typename, size_t>
+  friend class IntervalSet;
+};
+
+}  // namespace lil
@@ -0,0 +1,153 @@
+#pragma once
+
+// std
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/Binary.hpp>
+#include <lil/Err.hpp>
+#include <lil/Interval.hpp>
+
+namespace lil {
+
+/** @brief A static, augmented interval tree over up to N possibly overlapping Intervals.
+ *
+ * Intervals are sorted by min into a flat array that doubles as an implicit balanced binary search tree: the root of any
+ * index range [lo, hi) is its midpoint. Each node caches the greatest max within its subtree, which lets stabbing and
+ * overlap queries skip whole subtrees in O(log n + k) time without any pointers or heap allocation.
+ * @tparam T Same requirements as Interval.
+ * @tparam N Maximum number of Intervals that may be stored.
+ */
+template <typename T, size_t N>
+class IntervalTree {
+public:
+  using id_type = BitsToUInt_t<bitsToRepresent(N)>;  ///< Index of an Interval in the array passed to build().
+
+  /** @brief Constructs an empty tree. */
+  constexpr IntervalTree() noexcept
+      : _nodes{}
+      , _size(0)
+  {
+  }
+
+  constexpr size_t size() const noexcept { return _size; }
+  constexpr size_t capacity() const noexcept { return N; }
+  constexpr bool   empty() const noexcept { return _size == 0; }
+
+  /** @brief Replaces the contents of the tree with count Intervals. O(n log n).
+   * @return Err::RESOURCE_FULL if count exceeds N; the tree is left empty in that case.
+   */
+  Err build(const Interval<T>* intervals, size_t count) noexcept
+  {
+    _size = 0;
+    if (count > N)
+    {
+      return Err::RESOURCE_FULL;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      _nodes[i] = Node{ intervals[i], intervals[i].max, static_cast<id_type>(i) };
+    }
+    std::sort(&_nodes[0], &_nodes[count], [](const Node& lhs, const Node& rhs) {
+      return lhs.interval.min < rhs.interval.min;
+    });
+    _size = count;
+    augment(0, _size);
+    return Err::NONE;
+  }
+
+  /** @brief Invokes visit(id, interval) for every stored Interval that contains value.
+   * @return The number of Intervals visited.
+   */
+  template <typename TVisitor>
+  size_t stab(T value, TVisitor&& visit) const
+  {
+    return query(Interval<T>{ value, value }, visit);
+  }
+
+  /** @brief Invokes visit(id, interval) for every stored Interval that shares at least one value with interval.
+   * @return The number of Intervals visited.
+   */
+  template <typename TVisitor>
+  size_t overlapping(const Interval<T>& interval, TVisitor&& visit) const
+  {
+    return query(interval, visit);
+  }
+
+private:
+  struct Node {
+    Interval<T> interval;
+    T           subtree_max;  ///< Greatest interval.max in the implicit subtree rooted at this node.
+    id_type     id;
+  };
+
+  Node   _nodes[N];
+  size_t _size;
+
+  /** @brief Fills in subtree_max for the implicit subtree spanning [lo, hi) and returns it. */
+  T augment(size_t lo, size_t hi) noexcept
+  {
+    const auto mid  = lo + ((hi - lo) / 2);
+    auto&      node = _nodes[mid];
+    if (lo < mid)
+    {
+      node.subtree_max = maximum(node.subtree_max, augment(lo, mid));
+    }
+    if ((mid + 1) < hi)
+    {
+      node.subtree_max = maximum(node.subtree_max, augment(mid + 1, hi));
+    }
+    return node.subtree_max;
+  }
+
+  template <typename TVisitor>
+  size_t query(const Interval<T>& interval, TVisitor& visit) const
+  {
+    struct Range {
+      size_t lo;
+      size_t hi;
+    };
+
+    // The implicit tree is balanced, so its depth never exceeds the bit width of size_t.
+    Range  pending[Bit_Count_v<size_t>];
+    size_t depth   = 0;
+    size_t visited = 0;
+    if (_size > 0)
+    {
+      pending[depth++] = Range{ 0, _size };
+    }
+
+    while (depth > 0)
+    {
+      const auto range = pending[--depth];
+      const auto mid   = range.lo + ((range.hi - range.lo) / 2);
+      const auto& node = _nodes[mid];
+      if (node.subtree_max < interval.min)
+      {
+        continue;
+      }
+      if (!(interval.max < node.interval.min))
+      {
+        if (!(node.interval.max < interval.min))
+        {
+          visit(node.id, node.interval);
+          ++visited;
+        }
+        if ((mid + 1) < range.hi)
+        {
+          pending[depth++] = Range{ mid + 1, range.hi };
+        }
+      }
+      if (range.lo < mid)
+      {
+        pending[depth++] = Range{ range.lo, mid };
+      }
+    }
+    return visited;
+  }
+};
+
+}  // namespace lil
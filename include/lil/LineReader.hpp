@@ -0,0 +1,146 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <string_view>
+
+// local
+#include <lil/Err.hpp>
+#include <lil/Result.hpp>
+#include <lil/Str.hpp>
+
+/** @file
+ * Record reading for host builds, e.g. replaying multi-GB capture files through the parsers that run on device.
+ *
+ * A LineReader maps the file into memory when it can, so each record is a view of the mapping and nothing is copied;
+ * otherwise, e.g. for a pipe, it reads large aligned blocks with readahead hints and views records in its buffer.
+ * Records are found with memchr, which the C library vectorizes. A mapped file can also be split into chunks that end
+ * on record boundaries, for Records to walk in parallel.
+ * @code
+ * LineReader reader;
+ * if (reader.open("capture.csv") == NONE) { while (auto line = reader.next()) { parse(*line); } }
+ *
+ * std::string_view chunks[64];
+ * parallelFor(pool, chunks, reader.split(chunks, 64), [](std::string_view chunk) {
+ *   Records records(chunk);
+ *   while (auto line = records.next()) { parse(*line); }
+ * });
+ * @endcode
+ */
+
+namespace lil {
+
+/** @brief Splits a buffer into records ending at a delimiter, without copying; the last need not end with one. */
+class Records {
+public:
+  constexpr explicit Records(std::string_view text, char delimiter = '\n') noexcept
+      : _text(text)
+      , _delimiter(delimiter)
+  {
+  }
+
+  /** @return The next record, without its delimiter, or Err::RESOURCE_EMPTY after the last. */
+  Result<std::string_view> next() noexcept
+  {
+    if (_text.empty())
+    {
+      return RESOURCE_EMPTY;
+    }
+    const auto* end = static_cast<const char*>(memchr(_text.data(), _delimiter, _text.size()));
+    if (end == nullptr)
+    {
+      const auto last = _text;
+      _text           = {};
+      return last;
+    }
+    const std::string_view record(_text.data(), static_cast<size_t>(end - _text.data()));
+    _text.remove_prefix(record.size() + 1);
+    return record;
+  }
+
+  /** @brief The text not yet returned. */
+  constexpr std::string_view rest() const noexcept { return _text; }
+
+private:
+  std::string_view _text;
+  char             _delimiter;
+};
+
+/** @brief Reads a file record by record. Not thread safe; views it returns stay valid until the next call to next(),
+ * or, if the file is mapped(), until it is closed.
+ */
+class LineReader {
+public:
+  static constexpr size_t Default_Block = 1 << 20;  ///< Bytes read at a time when the file cannot be mapped.
+
+  enum class Mode : uint8_t {
+    Map,   ///< Map the file, or read it if it cannot be mapped.
+    Read,  ///< Read it a block at a time.
+  };
+
+  LineReader() noexcept = default;
+  ~LineReader() noexcept { close(); }
+
+  LineReader(const LineReader&)            = delete;
+  LineReader& operator=(const LineReader&) = delete;
+
+  /** @brief Opens path, closing any file already open.
+   * @param block Bytes to read at a time in Mode::Read, rounded up to a page; records longer than this are truncated.
+   * @return Err::PERMISSION_DENIED, Err::INVALID_ARGUMENT if path does not exist, Err::BAD_ALLOC for the block, or
+   * Err::OPERATION_FAILED.
+   */
+  Err open(const char* path, char delimiter = '\n', Mode mode = Mode::Map, size_t block = Default_Block) noexcept;
+
+  void close() noexcept;
+
+  /** @return The next record, without its delimiter, or Err::RESOURCE_EMPTY at the end of the file, or
+   * Err::RX_FAIL if reading failed.
+   */
+  Result<std::string_view> next() noexcept
+  {
+    if (auto record = _records.next())
+    {
+      return record;
+    }
+    return refill();
+  }
+
+  /** @brief Copies the next record into str, truncating it to fit. @return As next(). */
+  template <uint8_t Size>
+  Err next(Str<Size>& str) noexcept
+  {
+    const auto record = next();
+    if (record)
+    {
+      str.assign(record->data(), record->size());
+    }
+    return record.err();
+  }
+
+  /** @brief Splits a mapped file's unread records into up to count chunks of similar size that end on record
+   * boundaries, leaving them for the chunks alone. @return The number of chunks, or 0 if the file is not mapped.
+   */
+  size_t split(std::string_view* chunks, size_t count) noexcept;
+
+  bool   mapped() const noexcept { return _mapped; }
+  size_t size() const noexcept { return _size; }  ///< Bytes in the file, if mapped.
+
+private:
+  Records          _records{ {} };  ///< Complete records not yet returned
+  std::string_view _pending;        ///< A partial record at the end of the read buffer
+  char*            _data      = nullptr;  ///< The mapping or the read buffer
+  size_t           _size      = 0;        ///< Bytes mapped
+  size_t           _block     = 0;        ///< Bytes of the read buffer
+  int              _fd        = -1;
+  char             _delimiter = '\n';
+  bool             _mapped    = false;
+  bool             _ended     = false;  ///< Read to the end of the file
+  bool             _skipping  = false;  ///< Discarding the rest of a record longer than the buffer
+
+  /** @brief Reads blocks after the partial record in the buffer until it holds a complete one, and returns it. */
+  Result<std::string_view> refill() noexcept;
+};
+
+}  // namespace lil
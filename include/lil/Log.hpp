@@ -0,0 +1,119 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+// local
+#include <lil/ByteRing.hpp>
+#include <lil/Hash.hpp>
+#include <lil/detail/Intern.hpp>
+#include <lil/detail/LilConf.h>
+#include <lil/detail/Macro.hpp>
+
+/** @file
+ * Deferred binary logging: the device never formats text.
+ *
+ * Each LIL_LOG call site interns "file:line" and its printf style format string at compile time into a section of its
+ * own (lil_log.*). To keep the text out of flash, a linker script collects them into a non-allocated output section,
+ * e.g. `lil_log 0 (INFO) : { KEEP(*(lil_log.*)) }` as in tests/LogDecode.ld, which stays in the ELF for the decoder
+ * but not in the image; NOLOAD would not do, as it drops the contents from the ELF too. The call site's ID is the
+ * FNV-1a hash of that entry, so IDs are compile time constants and need no link step. At runtime a record is just the
+ * 32 bit ID followed by the raw arguments after C varargs promotion (integers narrower than int become int, float
+ * becomes double), written to a lock-free MpscByteRing in a few dozen cycles, so any thread or ISR may log at once.
+ * Formats are checked by the compiler like printf, which also guarantees the argument layout matches what
+ * tools/python/lil_log_decode.py derives from the format when it rebuilds the text from the ELF.
+ *
+ * %s arguments are logged as pointers and resolved by the decoder, so they must point at string literals or other data
+ * in the ELF image.
+ */
+
+namespace lil {
+
+using LogBuffer = MpscByteRing<LIL_LOG_BUFFER_SIZE>;
+
+/** @brief Returns the ring that LIL_LOG writes whole records to from any context; drain it with read() from a single
+ * consumer.
+ */
+LogBuffer& logBuffer() noexcept;
+
+/** @brief Returns how many records have been dropped because logBuffer() was full. */
+uint32_t logDropped() noexcept;
+
+namespace detail {
+constexpr uint32_t Log_Dropped_Id = 0;  ///< ID of the record that reports dropped records; followed by a uint32_t count.
+
+/** @brief Appends a record to logBuffer(), first reporting any records dropped since the last report; reentrant. */
+void logPush(const void* record, size_t size) noexcept;
+
+/** @brief Never called; lets the compiler check LIL_LOG formats against their arguments. */
+void logCheck(const char* format, ...) noexcept __attribute__((format(printf, 1, 2)));
+
+/** @brief Applies C varargs promotion, so the record layout matches what the format string implies. */
+template <typename T>
+constexpr auto logPromote(T value) noexcept
+{
+  if constexpr (std::is_floating_point<T>::value)
+  {
+    static_assert(sizeof(T) <= sizeof(double), "long double is not supported by LIL_LOG");
+    return static_cast<double>(value);
+  }
+  else if constexpr (std::is_enum<T>::value)
+  {
+    return +static_cast<std::underlying_type_t<T>>(value);
+  }
+  else if constexpr (std::is_pointer<T>::value || std::is_null_pointer<T>::value)
+  {
+    return static_cast<const void*>(value);
+  }
+  else
+  {
+    static_assert(std::is_integral<T>::value, "LIL_LOG arguments must be arithmetic, enums or pointers");
+    return +value;
+  }
+}
+
+template <typename... Ts>
+inline void logWrite(uint32_t id, Ts... args) noexcept
+{
+  uint8_t record[sizeof(id) + (sizeof(logPromote(args)) + ... + 0)];
+  size_t  offset = 0;
+  auto    put    = [&](const auto& value) {
+    memcpy(&record[offset], &value, sizeof(value));
+    offset += sizeof(value);
+  };
+  put(id);
+  (put(logPromote(args)), ...);
+  logPush(record, sizeof(record));
+}
+}  // namespace detail
+}  // namespace lil
+
+/** @brief The interned text of a call site: magic, "file:line", NUL, format. */
+#define LIL_LOG_ENTRY(format) LIL_LOG_MAGIC __FILE__ ":" LIL_STRINGIFY(__LINE__) "\0" format
+
+#if LIL_LOG_ENABLED
+/** @brief Logs a printf style message as a compact binary record. @see Log.hpp */
+#  define LIL_LOG(format, ...)                                                                                          \
+    do                                                                                                                  \
+    {                                                                                                                   \
+      LIL_LOG_SECTION static const char lil_log_entry[] = LIL_LOG_ENTRY(format);                                        \
+      constexpr uint32_t lil_log_id = ::lil::fnv1a(LIL_LOG_ENTRY(format), sizeof(LIL_LOG_ENTRY(format)) - 1);           \
+      if (false)                                                                                                        \
+      {                                                                                                                 \
+        ::lil::detail::logCheck(format __VA_OPT__(, ) __VA_ARGS__);                                                     \
+      }                                                                                                                 \
+      ::lil::detail::logWrite(lil_log_id __VA_OPT__(, ) __VA_ARGS__);                                                   \
+    } while (false)
+#else
+#  define LIL_LOG(format, ...)                                                                                          \
+    do                                                                                                                  \
+    {                                                                                                                   \
+      if (false)                                                                                                        \
+      {                                                                                                                 \
+        ::lil::detail::logCheck(format __VA_OPT__(, ) __VA_ARGS__);                                                     \
+      }                                                                                                                 \
+    } while (false)
+#endif
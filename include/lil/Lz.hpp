@@ -0,0 +1,331 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// local
+#include <lil/Err.hpp>
+#include <lil/Interval.hpp>
+#include <lil/Result.hpp>
+
+/** @file
+ * Fixed-memory LZ77 compression for log and telemetry buffers, in two sizes:
+ * - LzssEncoder and LzssDecoder stream a bit-packed LZSS format through windows as small as 16 bytes, the way
+ *   heatshrink does on devices. Neither allocates: the window is part of the object, so place it statically. sink()
+ *   takes what input fits and poll() returns what output is ready, so either side can sit between a ByteRing and a
+ *   flash page or a radio frame.
+ * - Lz4Encoder and lz4Decompress() read and write LZ4 blocks, for hosts where throughput matters more than RAM. Each
+ *   call handles one block, e.g. one frame, so blocks decode independently; the encoder's hash table is its arena.
+ * @code
+ * static LzssEncoder<8, 4> encoder;
+ * encoder.sink(record, size);
+ * page.size += encoder.poll(&page.data[page.size], sizeof(page.data) - page.size);
+ * @endcode
+ */
+
+namespace lil {
+
+namespace detail {
+template <uint8_t WindowBits, uint8_t LookaheadBits>
+struct LzssFormat {
+  static_assert((WindowBits >= 4) && (WindowBits <= 15), "LZSS windows span 16 B to 32 KB");
+  static_assert((LookaheadBits >= 3) && (LookaheadBits < WindowBits), "LZSS lookahead must be shorter than the window");
+
+  static constexpr size_t Window       = size_t(1) << WindowBits;
+  static constexpr size_t Literal_Bits = 1 + 8;                             ///< Flag, then the byte.
+  static constexpr size_t Backref_Bits = 1 + WindowBits + LookaheadBits;  ///< Flag, distance - 1, length - Min_Match.
+  static constexpr size_t Min_Match    = (Backref_Bits / Literal_Bits) + 1;  ///< Shortest match smaller as a backref.
+  static constexpr size_t Max_Match    = Min_Match + (size_t(1) << LookaheadBits) - 1;
+};
+
+/** @brief Compresses size bytes of data into out as one LZ4 block, matching through table, which holds 2^hashBits
+ * positions. Stale positions in table are harmless, so it need not be cleared between blocks.
+ */
+Result<size_t> lz4Compress(uint32_t* table, uint8_t hashBits, const uint8_t* data, size_t size, uint8_t* out,
+                           size_t capacity) noexcept;
+}  // namespace detail
+
+/** @brief Streams data into LZSS: a 1 flag bit and a literal byte, or a 0 flag bit and a backreference of WindowBits
+ * for its distance and LookaheadBits for its length, packed most significant bit first.
+ *
+ * Holds 2 windows of input: the history matches are found in, and the data not yet encoded. Matches are searched
+ * exhaustively, which is cheap for the small windows this is meant for.
+ * @tparam WindowBits log2 of the history searched for matches, 4 to 15, e.g. 8 for a 256 B window.
+ * @tparam LookaheadBits log2 of the longest match, 3 to WindowBits - 1, e.g. 4.
+ */
+template <uint8_t WindowBits, uint8_t LookaheadBits>
+class LzssEncoder {
+  using Format = detail::LzssFormat<WindowBits, LookaheadBits>;
+
+public:
+  static constexpr size_t Window = Format::Window;
+
+  /** @brief Copies as much of data into the input as fits. @return The bytes taken; 0 if poll() must run first. */
+  size_t sink(const void* data, size_t size) noexcept
+  {
+    if (_finishing)
+    {
+      return 0;
+    }
+    if ((_end == sizeof(_buffer)) && (_position > Window))
+    {
+      // Drops the history that the next byte to encode can no longer reach
+      const auto dropped = _position - Window;
+      memmove(_buffer, &_buffer[dropped], _end - dropped);
+      _begin     = (_begin > dropped) ? (_begin - dropped) : 0;
+      _position -= dropped;
+      _end      -= dropped;
+    }
+    const auto taken = minimum(size, sizeof(_buffer) - _end);
+    if (taken > 0)
+    {
+      memcpy(&_buffer[_end], data, taken);
+      _end += taken;
+    }
+    return taken;
+  }
+
+  /** @brief Ends the stream: poll() then encodes the input held back for longer matches, and pads the last byte. */
+  void finish() noexcept { _finishing = true; }
+
+  /** @brief Encodes input until out is full or more input is needed. @return The bytes written to out. */
+  size_t poll(void* out, size_t capacity) noexcept
+  {
+    auto*  bytes   = static_cast<uint8_t*>(out);
+    size_t written = 0;
+    for (;;)
+    {
+      for (; (_bitCount >= 8) && (written < capacity); _bitCount -= 8)
+      {
+        bytes[written++] = static_cast<uint8_t>(_bits >> (_bitCount - 8));
+      }
+      const auto remaining = _end - _position;
+      if ((_bitCount >= 8) || (remaining == 0) || (!_finishing && (remaining < Format::Max_Match)))
+      {
+        break;
+      }
+      encode();
+    }
+    if (_finishing && (_position == _end) && (_bitCount > 0) && (written < capacity))
+    {
+      // Zero padding reads as the start of a backreference too short to decode
+      bytes[written++] = static_cast<uint8_t>(_bits << (8 - _bitCount));
+      _bitCount        = 0;
+    }
+    return written;
+  }
+
+  /** @brief Whether finish() was called and poll() has returned all the output. */
+  bool finished() const noexcept { return _finishing && (_position == _end) && (_bitCount == 0); }
+
+  /** @brief Starts a new stream, forgetting the history. */
+  void reset() noexcept
+  {
+    _begin     = 0;
+    _position  = 0;
+    _end       = 0;
+    _bits      = 0;
+    _bitCount  = 0;
+    _finishing = false;
+  }
+
+private:
+  uint8_t  _buffer[2 * Window];  ///< [_begin, _position) is history, [_position, _end) is input.
+  size_t   _begin     = 0;
+  size_t   _position  = 0;
+  size_t   _end       = 0;
+  uint64_t _bits      = 0;  ///< Encoded bits not yet written, in the low _bitCount bits.
+  uint8_t  _bitCount  = 0;
+  bool     _finishing = false;
+
+  void push(uint64_t value, size_t count) noexcept
+  {
+    _bits      = (_bits << count) | value;
+    _bitCount += static_cast<uint8_t>(count);
+  }
+
+  /** @brief Encodes the byte at _position as a literal, or it and those after as the longest match in the history. */
+  void encode() noexcept
+  {
+    const auto lookahead = minimum(_end - _position, Format::Max_Match);
+    const auto first     = maximum(_begin, (_position > Window) ? (_position - Window) : size_t(0));
+    size_t     best      = 0;
+    size_t     distance  = 0;
+    for (auto candidate = _position; candidate-- > first;)
+    {
+      // A candidate can only beat the best match if it agrees on the byte after it
+      if (_buffer[candidate + best] != _buffer[_position + best])
+      {
+        continue;
+      }
+      size_t length = 0;
+      while ((length < lookahead) && (_buffer[candidate + length] == _buffer[_position + length]))
+      {
+        ++length;
+      }
+      if (length > best)
+      {
+        best     = length;
+        distance = _position - candidate;
+        if (best == lookahead)
+        {
+          break;
+        }
+      }
+    }
+
+    if (best >= Format::Min_Match)
+    {
+      push(0, 1);
+      push(distance - 1, WindowBits);
+      push(best - Format::Min_Match, LookaheadBits);
+      _position += best;
+    }
+    else
+    {
+      push(0x100U | _buffer[_position], Format::Literal_Bits);
+      _position += 1;
+    }
+  }
+};
+
+/** @brief Streams LZSS from an LzssEncoder with the same WindowBits and LookaheadBits back into the original bytes.
+ * @tparam InputBytes Compressed bytes sink() can hold before poll() must run.
+ */
+template <uint8_t WindowBits, uint8_t LookaheadBits, size_t InputBytes = 32>
+class LzssDecoder {
+  using Format = detail::LzssFormat<WindowBits, LookaheadBits>;
+
+public:
+  static constexpr size_t Window = Format::Window;
+
+  /** @brief Copies as much compressed data as fits. @return The bytes taken; 0 if poll() must run first. */
+  size_t sink(const void* data, size_t size) noexcept
+  {
+    if (_inputBegin > 0)
+    {
+      memmove(_input, &_input[_inputBegin], _inputEnd - _inputBegin);
+      _inputEnd   -= _inputBegin;
+      _inputBegin  = 0;
+    }
+    const auto taken = minimum(size, InputBytes - _inputEnd);
+    if (taken > 0)
+    {
+      memcpy(&_input[_inputEnd], data, taken);
+      _inputEnd += taken;
+    }
+    return taken;
+  }
+
+  /** @brief Decodes until out is full or more input is needed. @return The bytes written to out. */
+  size_t poll(void* out, size_t capacity) noexcept
+  {
+    auto*  bytes   = static_cast<uint8_t*>(out);
+    size_t written = 0;
+    while (written < capacity)
+    {
+      if (_copying > 0)
+      {
+        bytes[written++] = emit(_window[(_head - _distance) & (Window - 1)]);
+        --_copying;
+        continue;
+      }
+      for (; (_bitCount <= 56) && (_inputBegin < _inputEnd); _bitCount += 8)
+      {
+        _bits = (_bits << 8) | _input[_inputBegin++];
+      }
+      if ((_bitCount >= Format::Literal_Bits) && (peek(1) == 1))
+      {
+        bytes[written++] = emit(static_cast<uint8_t>(take(Format::Literal_Bits)));
+      }
+      else if ((_bitCount >= Format::Backref_Bits) && (peek(1) == 0))
+      {
+        take(1);
+        // Distances beyond the output so far read the zeroed window, as no encoder writes them
+        _distance = take(WindowBits) + 1;
+        _copying  = take(LookaheadBits) + Format::Min_Match;
+      }
+      else
+      {
+        break;
+      }
+    }
+    return written;
+  }
+
+  /** @brief Starts a new stream, forgetting the history. */
+  void reset() noexcept
+  {
+    memset(_window, 0, sizeof(_window));
+    _inputBegin = 0;
+    _inputEnd   = 0;
+    _head       = 0;
+    _distance   = 0;
+    _copying    = 0;
+    _bits       = 0;
+    _bitCount   = 0;
+  }
+
+private:
+  uint8_t  _window[Window]{};  ///< The last Window bytes output, a ring indexed by _head.
+  uint8_t  _input[InputBytes];
+  size_t   _inputBegin = 0;
+  size_t   _inputEnd   = 0;
+  size_t   _head       = 0;
+  size_t   _distance   = 0;  ///< Of the backreference being copied.
+  size_t   _copying    = 0;  ///< Bytes of it left to copy.
+  uint64_t _bits       = 0;  ///< Input bits not yet decoded, in the low _bitCount bits.
+  uint8_t  _bitCount   = 0;
+
+  uint64_t peek(size_t count) const noexcept { return (_bits >> (_bitCount - count)) & ((uint64_t(1) << count) - 1); }
+
+  uint64_t take(size_t count) noexcept
+  {
+    const auto value  = peek(count);
+    _bitCount        -= static_cast<uint8_t>(count);
+    return value;
+  }
+
+  uint8_t emit(uint8_t byte) noexcept
+  {
+    _window[_head++ & (Window - 1)] = byte;
+    return byte;
+  }
+};
+
+/** @return The most bytes an LZ4 block of size bytes can take, when none of them match. */
+constexpr size_t lz4Bound(size_t size) noexcept
+{
+  return size + (size / 255) + 16;
+}
+
+/** @brief Compresses blocks into the LZ4 block format, which any LZ4 decoder reads.
+ * @tparam HashBits log2 of the positions remembered to find matches; the table takes 4 << HashBits bytes.
+ */
+template <uint8_t HashBits = 12>
+class Lz4Encoder {
+public:
+  static_assert((HashBits >= 8) && (HashBits <= 20), "Lz4Encoder tables hold 2^8 to 2^20 positions");
+
+  /** @brief Compresses size bytes of data into out as one block.
+   * @return The bytes written, Err::RESOURCE_FULL if they exceed capacity, which lz4Bound(size) never does, or
+   * Err::INVALID_ARGUMENT if size is 4 GB or more.
+   */
+  Result<size_t> compress(const void* data, size_t size, void* out, size_t capacity) noexcept
+  {
+    return detail::lz4Compress(_table, HashBits, static_cast<const uint8_t*>(data), size, static_cast<uint8_t*>(out),
+                               capacity);
+  }
+
+private:
+  uint32_t _table[size_t(1) << HashBits]{};
+};
+
+/** @brief Decompresses one LZ4 block of size bytes into out.
+ * @return The bytes written, Err::RESOURCE_FULL if they exceed capacity, or Err::DECODE_FAIL if the block is malformed.
+ */
+Result<size_t> lz4Decompress(const void* data, size_t size, void* out, size_t capacity) noexcept;
+
+}  // namespace lil
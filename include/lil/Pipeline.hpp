@@ -0,0 +1,425 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+// local
+#include <lil/Interval.hpp>
+
+namespace lil {
+
+/** @brief A compile-time composed chain of signal conditioning stages that processes interleaved multi-channel samples
+ * in a single cache-resident pass.
+ *
+ * A stage is any type with:
+ * - `value_type` and `static constexpr size_t Channels` members;
+ * - `size_t process(value_type (*frames)[Channels], size_t count) noexcept`, which transforms count frames (one sample
+ *   per channel each) in place, compacts any frames it keeps to the front, e.g. when decimating, and returns how many
+ *   it kept.
+ *
+ * Samples are copied into a stack block of about Block_Bytes, every stage runs over that block while it stays in L1,
+ * and the survivors are copied out; a block touches memory once instead of once per stage. Stage loops have
+ * compile-time channel counts, so stateless stages vectorize over the whole block and filters vectorize across
+ * channels. The same stage type may appear more than once, e.g. to cascade biquads.
+ * @code
+ * Pipeline pipeline{ MovingAverage<float, 8, 4>{}, Clip<float, 4>{ { -1.0F, 1.0F } }, Decimate<float, 4, 4>{} };
+ * size_t   written = pipeline.process(in, out, frames);
+ * @endcode
+ */
+template <typename... Stages>
+class Pipeline;
+
+namespace detail {
+template <size_t I, typename TStage>
+struct StageSlot {
+  TStage stage;
+};
+
+template <typename TIndices, typename... Stages>
+class PipelineBase;
+
+template <size_t... Is, typename... Stages>
+class PipelineBase<std::index_sequence<Is...>, Stages...> : protected StageSlot<Is, Stages>... {
+public:
+  constexpr PipelineBase(Stages... stages) noexcept
+      : StageSlot<Is, Stages>{ stages }...
+  {
+  }
+
+protected:
+  template <size_t I, typename TStage>
+  static constexpr TStage& slot(StageSlot<I, TStage>& slot) noexcept
+  {
+    return slot.stage;
+  }
+
+  template <size_t I, typename TStage>
+  static constexpr const TStage& slot(const StageSlot<I, TStage>& slot) noexcept
+  {
+    return slot.stage;
+  }
+
+  template <typename TFrame>
+  constexpr size_t run(TFrame* frames, size_t count) noexcept
+  {
+    ((count = static_cast<StageSlot<Is, Stages>&>(*this).stage.process(frames, count)), ...);
+    return count;
+  }
+};
+
+template <typename TStage, typename... Stages>
+struct FirstStage {
+  using type = TStage;
+};
+}  // namespace detail
+
+template <typename... Stages>
+class Pipeline : public detail::PipelineBase<std::index_sequence_for<Stages...>, Stages...> {
+  using base_type  = detail::PipelineBase<std::index_sequence_for<Stages...>, Stages...>;
+  using first_type = typename detail::FirstStage<Stages...>::type;
+
+public:
+  using value_type                 = typename first_type::value_type;
+  static constexpr size_t Channels = first_type::Channels;
+
+  static_assert((std::is_same<value_type, typename Stages::value_type>::value && ...), "Stages must agree on type");
+  static_assert(((Channels == Stages::Channels) && ...), "Stages must agree on channel count");
+
+  static constexpr size_t Block_Bytes  = 1024;  ///< Approximate stack used per block; small enough to stay in L1.
+  static constexpr size_t Block_Frames = maximum(Block_Bytes / sizeof(value_type[Channels]), size_t(1));
+
+  constexpr Pipeline(Stages... stages) noexcept
+      : base_type(stages...)
+  {
+  }
+
+  /** @brief Returns the I-th stage, e.g. to retune a filter at runtime. */
+  template <size_t I>
+  constexpr auto& stage() noexcept
+  {
+    return base_type::template slot<I>(*this);
+  }
+
+  template <size_t I>
+  constexpr const auto& stage() const noexcept
+  {
+    return base_type::template slot<I>(*this);
+  }
+
+  /** @brief Runs one frame through every stage in place.
+   * @return False if a stage dropped the frame.
+   */
+  constexpr bool process(value_type (&frame)[Channels]) noexcept
+  {
+    return base_type::run(&frame, 1) == 1;
+  }
+
+  /** @brief Runs interleaved frames from in through every stage, writing surviving frames to out.
+   * @param in frames * Channels interleaved samples.
+   * @param out Room for up to frames * Channels samples; may alias in.
+   * @return Number of frames written to out.
+   */
+  size_t process(const value_type* in, value_type* out, size_t frames) noexcept
+  {
+    value_type block[Block_Frames][Channels];
+    size_t     written = 0;
+    for (size_t first = 0; first < frames; first += Block_Frames)
+    {
+      const auto count = minimum(frames - first, Block_Frames);
+      for (size_t i = 0; i < count; ++i)
+      {
+        for (size_t c = 0; c < Channels; ++c)
+        {
+          block[i][c] = in[((first + i) * Channels) + c];
+        }
+      }
+      const auto kept = base_type::run(block, count);
+      for (size_t i = 0; i < kept; ++i)
+      {
+        for (size_t c = 0; c < Channels; ++c)
+        {
+          out[((written + i) * Channels) + c] = block[i][c];
+        }
+      }
+      written += kept;
+    }
+    return written;
+  }
+};
+
+template <typename... Stages>
+Pipeline(Stages...) -> Pipeline<Stages...>;
+
+/** @brief Boxcar filter: averages the last Window samples of each channel.
+ * @pre Window times the largest sample magnitude fits in T, since a running sum is kept per channel.
+ */
+template <typename T, size_t Window, size_t NChannels = 1>
+class MovingAverage {
+public:
+  static_assert(Window >= 1, "MovingAverage needs at least one sample");
+  using value_type                 = T;
+  static constexpr size_t Channels = NChannels;
+
+  /** @brief Constructs a filter whose history is all zeroes. */
+  constexpr MovingAverage() noexcept
+      : _history{}
+      , _sum{}
+      , _index(0)
+  {
+  }
+
+  constexpr size_t process(T (*frames)[Channels], size_t count) noexcept
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      auto& oldest = _history[_index];
+      for (size_t c = 0; c < Channels; ++c)
+      {
+        const T sum  = (_sum[c] - oldest[c]) + frames[i][c];
+        oldest[c]    = frames[i][c];
+        _sum[c]      = sum;
+        frames[i][c] = sum / static_cast<int>(Window);
+      }
+      _index = (_index + 1 == Window) ? 0 : _index + 1;
+    }
+    return count;
+  }
+
+private:
+  T      _history[Window][Channels];
+  T      _sum[Channels];
+  size_t _index;
+};
+
+/** @brief Normalized (a0 == 1) second order IIR section coefficients. */
+template <typename T>
+struct BiquadCoefficients {
+  T b0;
+  T b1;
+  T b2;
+  T a1;
+  T a2;
+};
+
+/** @brief Second order IIR filter in transposed direct form II, one state pair per channel. */
+template <typename T, size_t NChannels = 1>
+class Biquad {
+public:
+  using value_type                 = T;
+  static constexpr size_t Channels = NChannels;
+
+  /** @brief Constructs a pass-through filter. */
+  constexpr Biquad() noexcept
+      : Biquad(BiquadCoefficients<T>{ T(1), T(), T(), T(), T() })
+  {
+  }
+
+  constexpr Biquad(const BiquadCoefficients<T>& coefficients) noexcept
+      : _coefficients(coefficients)
+      , _z1{}
+      , _z2{}
+  {
+  }
+
+  /** @brief Replaces the coefficients, keeping the filter state. */
+  constexpr void tune(const BiquadCoefficients<T>& coefficients) noexcept { _coefficients = coefficients; }
+
+  constexpr size_t process(T (*frames)[Channels], size_t count) noexcept
+  {
+    const auto k = _coefficients;
+    T          z1[Channels];
+    T          z2[Channels];
+    for (size_t c = 0; c < Channels; ++c)
+    {
+      z1[c] = _z1[c];
+      z2[c] = _z2[c];
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+      for (size_t c = 0; c < Channels; ++c)
+      {
+        const T x    = frames[i][c];
+        const T y    = (k.b0 * x) + z1[c];
+        z1[c]        = ((k.b1 * x) - (k.a1 * y)) + z2[c];
+        z2[c]        = (k.b2 * x) - (k.a2 * y);
+        frames[i][c] = y;
+      }
+    }
+    for (size_t c = 0; c < Channels; ++c)
+    {
+      _z1[c] = z1[c];
+      _z2[c] = z2[c];
+    }
+    return count;
+  }
+
+private:
+  BiquadCoefficients<T> _coefficients;
+  T                     _z1[Channels];
+  T                     _z2[Channels];
+};
+
+/** @brief Median of the last N samples of each channel; rejects impulse noise.
+ *
+ * The window is sorted with an odd-even transposition network of min/max operations, so all channels are sorted in
+ * lockstep without data-dependent branches.
+ */
+template <typename T, size_t N, size_t NChannels = 1>
+class Median {
+public:
+  static_assert((N % 2) == 1, "Median window must be odd");
+  using value_type                 = T;
+  static constexpr size_t Channels = NChannels;
+
+  /** @brief Constructs a filter whose history is all zeroes. */
+  constexpr Median() noexcept
+      : _history{}
+      , _index(0)
+  {
+  }
+
+  constexpr size_t process(T (*frames)[Channels], size_t count) noexcept
+  {
+    for (size_t f = 0; f < count; ++f)
+    {
+      T sorted[N][Channels];
+      for (size_t c = 0; c < Channels; ++c)
+      {
+        _history[_index][c] = frames[f][c];
+      }
+      _index = (_index + 1 == N) ? 0 : _index + 1;
+
+      for (size_t i = 0; i < N; ++i)
+      {
+        for (size_t c = 0; c < Channels; ++c)
+        {
+          sorted[i][c] = _history[i][c];
+        }
+      }
+      for (size_t round = 0; round < N; ++round)
+      {
+        for (size_t i = round % 2; (i + 1) < N; i += 2)
+        {
+          for (size_t c = 0; c < Channels; ++c)
+          {
+            const T lo       = minimum(sorted[i][c], sorted[i + 1][c]);
+            const T hi       = maximum(sorted[i][c], sorted[i + 1][c]);
+            sorted[i][c]     = lo;
+            sorted[i + 1][c] = hi;
+          }
+        }
+      }
+      for (size_t c = 0; c < Channels; ++c)
+      {
+        frames[f][c] = sorted[N / 2][c];
+      }
+    }
+    return count;
+  }
+
+private:
+  T      _history[N][Channels];
+  size_t _index;
+};
+
+/** @brief Limits every channel to an Interval. @see Interval::clip */
+template <typename T, size_t NChannels = 1>
+class Clip {
+public:
+  using value_type                 = T;
+  static constexpr size_t Channels = NChannels;
+
+  constexpr Clip(const Interval<T>& limits) noexcept
+      : range(limits)
+  {
+  }
+
+  constexpr size_t process(T (*frames)[Channels], size_t count) noexcept
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      for (size_t c = 0; c < Channels; ++c)
+      {
+        frames[i][c] = range.clip(frames[i][c]);
+      }
+    }
+    return count;
+  }
+
+  Interval<T> range;  ///< Values are clipped into this Interval.
+};
+
+/** @brief Replaces samples inside an Interval with a fixed value. @see Interval::deadband */
+template <typename T, size_t NChannels = 1>
+class Deadband {
+public:
+  using value_type                 = T;
+  static constexpr size_t Channels = NChannels;
+
+  /** @brief Replaces samples inside band with the midpoint of band. */
+  constexpr Deadband(const Interval<T>& dead) noexcept
+      : Deadband(dead, dead.mid())
+  {
+  }
+
+  constexpr Deadband(const Interval<T>& dead, T replacement) noexcept
+      : band(dead)
+      , value(replacement)
+  {
+  }
+
+  constexpr size_t process(T (*frames)[Channels], size_t count) noexcept
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      for (size_t c = 0; c < Channels; ++c)
+      {
+        frames[i][c] = band.deadband(frames[i][c], value);
+      }
+    }
+    return count;
+  }
+
+  Interval<T> band;   ///< Samples within this Interval are replaced.
+  T           value;  ///< Replacement for samples within band.
+};
+
+/** @brief Keeps every Factor-th frame and drops the rest. Filter before decimating to avoid aliasing. */
+template <typename T, size_t Factor, size_t NChannels = 1>
+class Decimate {
+public:
+  static_assert(Factor >= 1, "Decimate factor must be at least 1");
+  using value_type                 = T;
+  static constexpr size_t Channels = NChannels;
+
+  constexpr Decimate() noexcept
+      : _phase(0)
+  {
+  }
+
+  constexpr size_t process(T (*frames)[Channels], size_t count) noexcept
+  {
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+      _phase = (_phase + 1 == Factor) ? 0 : _phase + 1;
+      if (_phase == 0)
+      {
+        for (size_t c = 0; c < Channels; ++c)
+        {
+          frames[kept][c] = frames[i][c];
+        }
+        ++kept;
+      }
+    }
+    return kept;
+  }
+
+private:
+  size_t _phase;
+};
+
+}  // namespace lil
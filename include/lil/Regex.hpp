@@ -0,0 +1,1119 @@
+#pragma once
+
+// std
+#include <array>
+#include <bit>
+#include <stddef.h>
+#include <stdint.h>
+#include <string_view>
+
+// local
+#include <lil/detail/LilConf.h>
+
+/** @file
+ * Regular expressions compiled while the program is: no heap, no exceptions, and no backtracking at runtime.
+ *
+ * Regex<"pattern"> parses its pattern at compile time into a small Thompson NFA program, and from that builds a DFA of
+ * up to LIL_REGEX_DFA_STATES states, so that match() and search() take one table lookup per byte. match() captures
+ * with the DFA too when the pattern is one-pass, i.e. never lets two alternatives consume the same byte, as
+ * `(\d+)\.(\d+)` does not. Otherwise, and when the DFA would be too large, every alternative of the NFA runs in lockstep
+ * over the text instead (a Pike VM). Either way matching takes time linear in the text however the pattern is
+ * written. A malformed pattern fails to compile with a call to regexSyntaxError(). Everything is constexpr.
+ * @code
+ * using Version = Regex<R"((\d+)\.(\d+)\.(\d+))">;
+ *
+ * Version::Captures version;
+ * if (Version::match(text, version)) { major = version[1]; }  // views into text
+ * static_assert(Regex<"[a-z]+(/[a-z0-9_]+)*">::match("imu/raw"));
+ * @endcode
+ *
+ * Supported syntax, matched byte by byte:
+ * - literals, `.` (any byte), `\` escapes of punctuation, `\t \n \r \f \v`;
+ * - classes `[a-z_]`, `[^/]`, and `\d \D \w \W \s \S` inside or outside them;
+ * - groups `(...)`, which capture, and `(?:...)`, which do not; alternation `|`; anchors `^ $`;
+ * - quantifiers `* + ? {n} {n,} {n,m}`, each of which may be made lazy with a trailing `?`.
+ * Captures take the last text a group matched, and the leftmost, then highest priority, match wins, as in Perl.
+ */
+
+namespace lil {
+
+namespace detail {
+/** @brief A pattern given as a template argument, e.g. Regex<"[a-z]+">. */
+template <size_t Size>
+struct RegexPattern {
+  char text[Size]{};
+
+  constexpr RegexPattern(const char (&pattern)[Size]) noexcept
+  {
+    for (size_t i = 0; i < Size; ++i)
+    {
+      text[i] = pattern[i];
+    }
+  }
+
+  constexpr size_t size() const noexcept { return Size - 1; }
+};
+
+enum class RegexOp : uint8_t {
+  Char,   ///< Consumes chr
+  Class,  ///< Consumes a byte in classes[x]
+  Any,    ///< Consumes any byte
+  Split,  ///< Continues at x, then, at lower priority, at y
+  Jump,   ///< Continues at x
+  Save,   ///< Records the position in capture slot x
+  Begin,  ///< Asserts the start of the text
+  End,    ///< Asserts the end of the text
+  Match,
+};
+
+struct RegexInst {
+  RegexOp  op  = RegexOp::Match;
+  uint8_t  chr = 0;
+  uint16_t x   = 0;
+  uint16_t y   = 0;
+};
+
+/** @brief A set of bytes. */
+struct RegexClass {
+  uint64_t bits[4]{};
+
+  constexpr bool contains(char chr) const noexcept
+  {
+    const auto byte = static_cast<uint8_t>(chr);
+    return ((bits[byte >> 6] >> (byte & 63)) & 1) != 0;
+  }
+
+  constexpr void add(uint8_t first, uint8_t last) noexcept
+  {
+    for (unsigned byte = first; byte <= last; ++byte)
+    {
+      bits[byte >> 6] |= uint64_t(1) << (byte & 63);
+    }
+  }
+
+  constexpr void add(const RegexClass& other) noexcept
+  {
+    for (size_t i = 0; i < 4; ++i)
+    {
+      bits[i] |= other.bits[i];
+    }
+  }
+
+  constexpr void invert() noexcept
+  {
+    for (auto& word : bits)
+    {
+      word = ~word;
+    }
+  }
+};
+
+/** @brief Not constexpr, so that a malformed pattern fails to compile at the point it was found. */
+inline void regexSyntaxError() noexcept
+{
+}
+
+template <size_t Insts, size_t Classes>
+struct RegexProgram {
+  std::array<RegexInst, Insts>    code{};
+  std::array<RegexClass, Classes> classes{};
+
+  /** @return Whether the instruction at pc consumes chr. */
+  constexpr bool consumes(size_t pc, char chr) const noexcept
+  {
+    switch (code[pc].op)
+    {
+    case RegexOp::Char: return static_cast<uint8_t>(chr) == code[pc].chr;
+    case RegexOp::Class: return classes[code[pc].x].contains(chr);
+    case RegexOp::Any: return true;
+    default: return false;
+    }
+  }
+};
+
+/** @brief Parses a pattern by recursive descent over ranges of it, emitting code for each copy a quantifier needs.
+ *
+ * Without storage it only counts instructions, so that the program can then be compiled into an array of exactly
+ * that size. Classes and groups are numbered by their position in the pattern, so copies share them.
+ */
+class RegexCompiler {
+public:
+  static constexpr size_t Unbounded = SIZE_MAX;
+
+  struct Tokens {
+    size_t groups  = 0;  ///< Capturing groups
+    size_t classes = 0;  ///< Bracket expressions and class escapes
+  };
+
+  constexpr RegexCompiler(const char* text, size_t size, RegexInst* code = nullptr, RegexClass* classes = nullptr)
+      : _text(text)
+      , _size(size)
+      , _code(code)
+      , _classes(classes)
+  {
+  }
+
+  /** @return The number of instructions in the program, the last of which is its only Match. */
+  constexpr size_t compile() noexcept
+  {
+    _insts = 0;
+    emit({ RegexOp::Save, 0, 0, 0 });
+    alternation(0, _size);
+    emit({ RegexOp::Save, 0, 1, 0 });
+    emit({ RegexOp::Match });
+    return _insts;
+  }
+
+  /** @return The groups and classes that start before pos. */
+  constexpr Tokens tokensBefore(size_t pos) const noexcept
+  {
+    Tokens tokens;
+    for (size_t i = 0; i < pos;)
+    {
+      if (_text[i] == '[')
+      {
+        ++tokens.classes;
+        i = classEnd(i);
+      }
+      else if (_text[i] == '\\')
+      {
+        tokens.classes += isClassEscape(_text[i + 1]) ? 1 : 0;
+        i += 2;
+      }
+      else
+      {
+        tokens.groups += ((_text[i] == '(') && (_text[i + 1] != '?')) ? 1 : 0;
+        ++i;
+      }
+    }
+    return tokens;
+  }
+
+private:
+  const char* _text;
+  size_t      _size;
+  RegexInst*  _code;
+  RegexClass* _classes;
+  size_t      _insts = 0;
+
+  static constexpr bool isDigit(char chr) noexcept { return (chr >= '0') && (chr <= '9'); }
+  static constexpr bool isClassEscape(char chr) noexcept
+  {
+    return (chr == 'd') || (chr == 'D') || (chr == 'w') || (chr == 'W') || (chr == 's') || (chr == 'S');
+  }
+
+  constexpr size_t emit(RegexInst inst) noexcept
+  {
+    if (_code)
+    {
+      _code[_insts] = inst;
+    }
+    return _insts++;
+  }
+
+  /** @brief Points the Split at index to body and exit, preferring body unless lazy. */
+  constexpr void patchSplit(size_t index, size_t body, size_t exit, bool lazy) noexcept
+  {
+    if (_code)
+    {
+      _code[index].x = static_cast<uint16_t>(lazy ? exit : body);
+      _code[index].y = static_cast<uint16_t>(lazy ? body : exit);
+    }
+  }
+
+  constexpr void patchJump(size_t index, size_t target) noexcept
+  {
+    if (_code)
+    {
+      _code[index].x = static_cast<uint16_t>(target);
+    }
+  }
+
+  /** @return The index after the bracket expression starting at begin. */
+  constexpr size_t classEnd(size_t begin) const noexcept
+  {
+    auto i = begin + 1;
+    i += ((i < _size) && (_text[i] == '^')) ? 1 : 0;
+    i += ((i < _size) && (_text[i] == ']')) ? 1 : 0;
+    for (; (i < _size) && (_text[i] != ']'); ++i)
+    {
+      i += (_text[i] == '\\') ? 1 : 0;
+    }
+    if (i >= _size)
+    {
+      regexSyntaxError();
+    }
+    return i + 1;
+  }
+
+  /** @return The index after the atom starting at begin, not including its quantifier. */
+  constexpr size_t atomEnd(size_t begin, size_t end) const noexcept
+  {
+    if (_text[begin] == '[')
+    {
+      return classEnd(begin);
+    }
+    if (_text[begin] == '\\')
+    {
+      if ((begin + 1) >= end)
+      {
+        regexSyntaxError();
+      }
+      return begin + 2;
+    }
+    if (_text[begin] != '(')
+    {
+      return begin + 1;
+    }
+    size_t depth = 0;
+    for (auto i = begin; i < end;)
+    {
+      if (_text[i] == '[')
+      {
+        i = classEnd(i);
+        continue;
+      }
+      depth += (_text[i] == '(') ? 1 : 0;
+      depth -= (_text[i] == ')') ? 1 : 0;
+      i += (_text[i] == '\\') ? 2 : 1;
+      if (depth == 0)
+      {
+        return i;
+      }
+    }
+    regexSyntaxError();
+    return end;
+  }
+
+  /** @return The index of the first '|' outside groups and classes in [begin, end), or end. */
+  constexpr size_t alternative(size_t begin, size_t end) const noexcept
+  {
+    for (auto i = begin; i < end; i = atomEnd(i, end))
+    {
+      if (_text[i] == '|')
+      {
+        return i;
+      }
+    }
+    return end;
+  }
+
+  constexpr void alternation(size_t begin, size_t end) noexcept
+  {
+    const auto bar = alternative(begin, end);
+    if (bar == end)
+    {
+      sequence(begin, end);
+      return;
+    }
+    const auto split = emit({ RegexOp::Split });
+    sequence(begin, bar);
+    const auto jump = emit({ RegexOp::Jump });
+    patchSplit(split, split + 1, _insts, false);
+    alternation(bar + 1, end);
+    patchJump(jump, _insts);
+  }
+
+  constexpr size_t number(size_t& pos, size_t end) const noexcept
+  {
+    if ((pos >= end) || !isDigit(_text[pos]))
+    {
+      regexSyntaxError();
+    }
+    size_t value = 0;
+    for (; (pos < end) && isDigit(_text[pos]); ++pos)
+    {
+      value = (value * 10) + static_cast<size_t>(_text[pos] - '0');
+    }
+    return value;
+  }
+
+  /** @brief Parses the quantifier at pos, if any, into min and max copies. */
+  constexpr size_t quantifier(size_t pos, size_t end, size_t& min, size_t& max) const noexcept
+  {
+    min = 1;
+    max = 1;
+    if (pos >= end)
+    {
+      return pos;
+    }
+    switch (_text[pos])
+    {
+    case '*':
+      min = 0;
+      max = Unbounded;
+      return pos + 1;
+    case '+':
+      max = Unbounded;
+      return pos + 1;
+    case '?':
+      min = 0;
+      return pos + 1;
+    case '{': break;
+    default: return pos;
+    }
+    ++pos;
+    min = number(pos, end);
+    max = min;
+    if ((pos < end) && (_text[pos] == ','))
+    {
+      ++pos;
+      max = ((pos < end) && (_text[pos] == '}')) ? Unbounded : number(pos, end);
+    }
+    if ((pos >= end) || (_text[pos] != '}') || (max < min))
+    {
+      regexSyntaxError();
+    }
+    return pos + 1;
+  }
+
+  constexpr void sequence(size_t begin, size_t end) noexcept
+  {
+    for (auto pos = begin; pos < end;)
+    {
+      const auto atom   = pos;
+      const auto suffix = atomEnd(atom, end);
+      size_t     min    = 1;
+      size_t     max    = 1;
+      pos               = quantifier(suffix, end, min, max);
+      const bool lazy   = (pos != suffix) && (pos < end) && (_text[pos] == '?');
+      pos += lazy ? 1 : 0;
+      repeat(atom, min, max, lazy);
+    }
+  }
+
+  constexpr void repeat(size_t atom, size_t min, size_t max, bool lazy) noexcept
+  {
+    for (size_t i = 1; i < min; ++i)
+    {
+      single(atom);
+    }
+    if ((min > 0) && (max == Unbounded))
+    {
+      // The last required copy loops back on itself: e+
+      const auto body = _insts;
+      single(atom);
+      const auto split = emit({ RegexOp::Split });
+      patchSplit(split, body, _insts, lazy);
+      return;
+    }
+    if (min > 0)
+    {
+      single(atom);
+    }
+    if (max == Unbounded)
+    {
+      // e*
+      const auto split = emit({ RegexOp::Split });
+      single(atom);
+      patchJump(emit({ RegexOp::Jump }), split);
+      patchSplit(split, split + 1, _insts, lazy);
+      return;
+    }
+    optional(atom, max - min, lazy);
+  }
+
+  /** @brief Emits count nested optional copies, (e(e)?)?, so that each copy is only tried after the one before. */
+  constexpr void optional(size_t atom, size_t count, bool lazy) noexcept
+  {
+    if (count == 0)
+    {
+      return;
+    }
+    const auto split = emit({ RegexOp::Split });
+    single(atom);
+    optional(atom, count - 1, lazy);
+    patchSplit(split, split + 1, _insts, lazy);
+  }
+
+  /** @brief Returns the byte an escape stands for, or adds the class it stands for to cls and returns -1. */
+  constexpr int escape(char chr, RegexClass& cls) const noexcept
+  {
+    RegexClass escaped;
+    switch (chr)
+    {
+    case 't': return '\t';
+    case 'n': return '\n';
+    case 'r': return '\r';
+    case 'f': return '\f';
+    case 'v': return '\v';
+    case 'd':
+    case 'D': escaped.add('0', '9'); break;
+    case 'w':
+    case 'W':
+      escaped.add('0', '9');
+      escaped.add('A', 'Z');
+      escaped.add('a', 'z');
+      escaped.add('_', '_');
+      break;
+    case 's':
+    case 'S':
+      escaped.add(' ', ' ');
+      escaped.add('\t', '\r');
+      break;
+    default:
+      if (((chr >= 'a') && (chr <= 'z')) || ((chr >= 'A') && (chr <= 'Z')) || isDigit(chr))
+      {
+        regexSyntaxError();
+      }
+      return static_cast<uint8_t>(chr);
+    }
+    if ((chr >= 'A') && (chr <= 'Z'))
+    {
+      escaped.invert();
+    }
+    cls.add(escaped);
+    return -1;
+  }
+
+  constexpr void emitClass(size_t pos, const RegexClass& cls) noexcept
+  {
+    const auto index = tokensBefore(pos).classes;
+    if (_classes)
+    {
+      _classes[index] = cls;
+    }
+    emit({ RegexOp::Class, 0, static_cast<uint16_t>(index), 0 });
+  }
+
+  constexpr void bracket(size_t begin) noexcept
+  {
+    RegexClass cls;
+    auto       i      = begin + 1;
+    const bool negate = (_text[i] == '^');
+    i += negate ? 1 : 0;
+    for (bool first = true; first || (_text[i] != ']'); first = false)
+    {
+      auto low = (_text[i] == '\\') ? escape(_text[i + 1], cls) : static_cast<uint8_t>(_text[i]);
+      i += (_text[i] == '\\') ? 2 : 1;
+      if (low < 0)
+      {
+        continue;
+      }
+      auto high = low;
+      if ((_text[i] == '-') && (_text[i + 1] != ']'))
+      {
+        high = (_text[i + 1] == '\\') ? escape(_text[i + 2], cls) : static_cast<uint8_t>(_text[i + 1]);
+        i += (_text[i + 1] == '\\') ? 3 : 2;
+        if (high < low)
+        {
+          regexSyntaxError();
+        }
+      }
+      cls.add(static_cast<uint8_t>(low), static_cast<uint8_t>(high));
+    }
+    if (negate)
+    {
+      cls.invert();
+    }
+    emitClass(begin, cls);
+  }
+
+  /** @brief Emits one copy of the atom at pos. */
+  constexpr void single(size_t pos) noexcept
+  {
+    switch (_text[pos])
+    {
+    case '(':
+    {
+      const auto end = atomEnd(pos, _size) - 1;
+      if (_text[pos + 1] == '?')
+      {
+        if (_text[pos + 2] != ':')
+        {
+          regexSyntaxError();
+        }
+        alternation(pos + 3, end);
+        return;
+      }
+      const auto slot = static_cast<uint16_t>(2 * (tokensBefore(pos).groups + 1));
+      emit({ RegexOp::Save, 0, slot, 0 });
+      alternation(pos + 1, end);
+      emit({ RegexOp::Save, 0, static_cast<uint16_t>(slot + 1), 0 });
+      return;
+    }
+    case '[': bracket(pos); return;
+    case '.': emit({ RegexOp::Any }); return;
+    case '^': emit({ RegexOp::Begin }); return;
+    case '$': emit({ RegexOp::End }); return;
+    case '\\':
+    {
+      RegexClass cls;
+      const auto chr = escape(_text[pos + 1], cls);
+      if (chr < 0)
+      {
+        emitClass(pos, cls);
+        return;
+      }
+      emit({ RegexOp::Char, static_cast<uint8_t>(chr) });
+      return;
+    }
+    case ')':
+    case '*':
+    case '+':
+    case '?':
+    case '{':
+    case '|': regexSyntaxError(); return;
+    default: emit({ RegexOp::Char, static_cast<uint8_t>(_text[pos]) }); return;
+    }
+  }
+};
+
+/** @brief A set of program counters; as a DFA state, the threads about to run and whether the text starts here. */
+template <size_t Insts>
+struct RegexThreadSet {
+  std::array<uint64_t, (Insts + 63) / 64> pcs{};
+  bool                                    begin = false;
+
+  constexpr bool operator==(const RegexThreadSet&) const noexcept = default;
+
+  constexpr bool has(size_t pc) const noexcept { return ((pcs[pc / 64] >> (pc % 64)) & 1) != 0; }
+  constexpr void add(size_t pc) noexcept { pcs[pc / 64] |= uint64_t(1) << (pc % 64); }
+};
+
+/** @brief The threads that consume or match, reached from others without consuming, with the capture slots saved on
+ * the way to each; ambiguous if some thread is reached with two different sets, or a slot beyond the 64th.
+ */
+template <size_t Insts>
+struct RegexClosure {
+  RegexThreadSet<Insts>        threads;
+  std::array<uint64_t, Insts> saves{};
+  bool                         ambiguous = false;
+};
+
+template <size_t Insts, size_t Classes>
+constexpr RegexClosure<Insts> regexClosure(const RegexProgram<Insts, Classes>& program,
+                                           const RegexThreadSet<Insts>& threads, bool end) noexcept
+{
+  RegexClosure<Insts>          closure;
+  RegexThreadSet<Insts>        seen;
+  std::array<uint16_t, Insts> stack{};
+  size_t                       depth = 0;
+  for (size_t pc = 0; pc < Insts; ++pc)
+  {
+    if (threads.has(pc))
+    {
+      seen.add(pc);
+      stack[depth++] = static_cast<uint16_t>(pc);
+    }
+  }
+  while (depth > 0)
+  {
+    const auto pc    = stack[--depth];
+    const auto inst  = program.code[pc];
+    auto       saves = closure.saves[pc];
+    uint16_t   next[2]{};
+    size_t     count = 0;
+    switch (inst.op)
+    {
+    case RegexOp::Jump: next[count++] = inst.x; break;
+    case RegexOp::Split:
+      next[count++] = inst.x;
+      next[count++] = inst.y;
+      break;
+    case RegexOp::Save:
+      closure.ambiguous = closure.ambiguous || (inst.x >= 64);
+      saves |= uint64_t(1) << (inst.x % 64);
+      next[count++] = static_cast<uint16_t>(pc + 1);
+      break;
+    case RegexOp::Begin:
+    case RegexOp::End:
+      if ((inst.op == RegexOp::Begin) ? threads.begin : end)
+      {
+        next[count++] = static_cast<uint16_t>(pc + 1);
+      }
+      break;
+    default: closure.threads.add(pc); break;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (!seen.has(next[i]))
+      {
+        seen.add(next[i]);
+        closure.saves[next[i]] = saves;
+        stack[depth++]         = next[i];
+      }
+      else
+      {
+        closure.ambiguous = closure.ambiguous || (closure.saves[next[i]] != saves);
+      }
+    }
+  }
+  return closure;
+}
+
+/** @brief Groups the bytes that every instruction of a program treats alike, so a DFA needs one column per group. */
+struct RegexByteClasses {
+  std::array<uint8_t, 256> of{};
+  size_t                   count = 1;
+
+  template <size_t Insts, size_t Classes>
+  constexpr explicit RegexByteClasses(const RegexProgram<Insts, Classes>& program) noexcept
+  {
+    for (size_t pc = 0; pc < Insts; ++pc)
+    {
+      const auto op = program.code[pc].op;
+      if ((op != RegexOp::Char) && (op != RegexOp::Class))
+      {
+        continue;
+      }
+      // Splits each group into the bytes pc consumes and those it does not
+      int renamed[2 * 256]{};
+      int groups = 0;
+      for (size_t byte = 0; byte < 256; ++byte)
+      {
+        const auto chr      = static_cast<char>(byte);
+        const bool consumed = (op == RegexOp::Char) ? (byte == program.code[pc].chr)
+                                                    : program.classes[program.code[pc].x].contains(chr);
+        auto& group = renamed[(2 * of[byte]) + (consumed ? 1 : 0)];
+        group       = (group == 0) ? ++groups : group;
+        of[byte]    = static_cast<uint8_t>(group - 1);
+      }
+      count = static_cast<size_t>(groups);
+    }
+  }
+};
+
+/** @brief A DFA built by subset construction over a program's threads, with state 0 dead and state 1 initial.
+ *
+ * Unanchored, every state also starts a thread at the beginning of the program, so that it finds matches anywhere.
+ * When the automaton needs more than Capacity states, states is Capacity + 1 and the DFA must not be used.
+ *
+ * Capturing, it also records the capture slots each transition saves, and whether the program is one-pass: whether
+ * at most one thread can consume each byte, so that those slots are the captures whichever way the text matches.
+ */
+template <size_t Capacity, size_t Columns, bool Capturing>
+struct RegexDfa {
+  static constexpr uint8_t Matched = 1;  ///< The text up to here matches
+  static constexpr uint8_t At_End  = 2;  ///< The text matches if it ends here
+
+  std::array<uint8_t, 256>                                     byteClass{};
+  std::array<uint8_t, Capacity * Columns>                      next{};
+  std::array<uint8_t, Capacity>                                accepts{};
+  std::array<uint64_t, Capturing ? (Capacity * Columns) : 0> saves{};     ///< Slots to set before each transition
+  std::array<uint64_t, Capturing ? Capacity : 0>             endSaves{};  ///< Slots to set if the text ends here
+  size_t                                                       states  = 0;
+  bool                                                         onePass = Capturing;
+
+  constexpr RegexDfa() noexcept = default;
+
+  /** @brief Copies the states of a DFA built with more room than it needed. */
+  template <size_t OtherCapacity>
+  constexpr explicit RegexDfa(const RegexDfa<OtherCapacity, Columns, Capturing>& other) noexcept
+      : byteClass(other.byteClass)
+      , states(other.states)
+      , onePass(other.onePass)
+  {
+    for (size_t state = 0; (state < Capacity) && (state < states); ++state)
+    {
+      accepts[state] = other.accepts[state];
+      for (size_t column = 0; column < Columns; ++column)
+      {
+        next[(state * Columns) + column] = other.next[(state * Columns) + column];
+      }
+      if constexpr (Capturing)
+      {
+        endSaves[state] = other.endSaves[state];
+        for (size_t column = 0; column < Columns; ++column)
+        {
+          saves[(state * Columns) + column] = other.saves[(state * Columns) + column];
+        }
+      }
+    }
+  }
+
+  template <size_t Insts, size_t Classes>
+  constexpr RegexDfa(const RegexProgram<Insts, Classes>& program, bool anchored) noexcept
+  {
+    const RegexByteClasses byteClasses(program);
+    byteClass = byteClasses.of;
+
+    // Whether each instruction consumes the bytes of each column, as seen by one byte of it
+    std::array<size_t, Columns> bytes{};
+    for (size_t byte = 256; byte-- > 0;)
+    {
+      bytes[byteClass[byte]] = byte;
+    }
+    std::array<std::array<bool, Columns>, Insts> consumes{};
+    for (size_t pc = 0; pc < Insts; ++pc)
+    {
+      for (size_t column = 0; column < Columns; ++column)
+      {
+        consumes[pc][column] = program.consumes(pc, static_cast<char>(bytes[column]));
+      }
+    }
+
+    std::array<RegexThreadSet<Insts>, Capacity> kernels{};
+    kernels[1].add(0);
+    kernels[1].begin = true;
+    states           = 2;
+    for (size_t state = 0; (state < states) && (states <= Capacity); ++state)
+    {
+      const auto running = regexClosure(program, kernels[state], false);
+      const auto ending  = regexClosure(program, kernels[state], true);
+      accepts[state] |= running.threads.has(Insts - 1) ? Matched : 0;
+      accepts[state] |= ending.threads.has(Insts - 1) ? At_End : 0;
+      if constexpr (Capturing)
+      {
+        onePass         = onePass && !running.ambiguous && !ending.ambiguous;
+        endSaves[state] = ending.saves[Insts - 1];
+      }
+      for (size_t column = 0; column < Columns; ++column)
+      {
+        RegexThreadSet<Insts> kernel;
+        size_t                consumers = 0;
+        for (size_t pc = 0; pc < Insts; ++pc)
+        {
+          if (consumes[pc][column] && running.threads.has(pc))
+          {
+            kernel.add(pc + 1);
+            ++consumers;
+            if constexpr (Capturing)
+            {
+              saves[(state * Columns) + column] = running.saves[pc];
+            }
+          }
+        }
+        onePass = onePass && (consumers <= 1);
+        if (!anchored && (state != 0))
+        {
+          kernel.add(0);
+        }
+        size_t target = 0;
+        while ((target < states) && !(kernels[target] == kernel))
+        {
+          ++target;
+        }
+        if (target == states)
+        {
+          if (states == Capacity)
+          {
+            states = Capacity + 1;
+            return;
+          }
+          kernels[states++] = kernel;
+        }
+        next[(state * Columns) + column] = static_cast<uint8_t>(target);
+      }
+    }
+  }
+};
+}  // namespace detail
+
+/** @brief A regular expression whose program is compiled from Pattern at compile time; see Regex.hpp.
+ *
+ * The matchers use no heap and no static state, so they may run from any number of contexts at once. Their stack use
+ * grows with the size of the program, and when capturing with the number of groups too.
+ */
+template <detail::RegexPattern Pattern>
+class Regex {
+  static constexpr detail::RegexCompiler Compiler{ Pattern.text, Pattern.size() };
+  static constexpr size_t                Insts   = detail::RegexCompiler(Compiler).compile();
+  static constexpr auto                  Tokens  = Compiler.tokensBefore(Pattern.size());
+  static constexpr auto                  Program = [] {
+    detail::RegexProgram<Insts, Tokens.classes> program;
+    detail::RegexCompiler(Pattern.text, Pattern.size(), program.code.data(), program.classes.data()).compile();
+    return program;
+  }();
+  static constexpr size_t Columns = detail::RegexByteClasses(Program).count;
+
+  /** @brief The DFA, sized to its states once they are known; unused if it needs more than LIL_REGEX_DFA_STATES. */
+  template <bool Anchored, bool Capturing = Anchored && (Tokens.groups > 0)>
+  static constexpr auto Dfa = [] {
+    constexpr detail::RegexDfa<LIL_REGEX_DFA_STATES, Columns, Capturing> built(Program, Anchored);
+    return detail::RegexDfa<(built.states <= LIL_REGEX_DFA_STATES) ? built.states : 2, Columns, Capturing>(built);
+  }();
+
+  template <bool Anchored>
+  static constexpr bool Deterministic = Dfa<Anchored>.states <= Dfa<Anchored>.accepts.size();
+
+  static_assert(Insts <= UINT16_MAX, "Regex pattern compiles to too many instructions");
+  static_assert((LIL_REGEX_DFA_STATES >= 2) && (LIL_REGEX_DFA_STATES <= UINT8_MAX),
+                "LIL_REGEX_DFA_STATES must be from 2 to 255");
+
+public:
+  static constexpr size_t Groups = Tokens.groups;  ///< Capturing groups in the pattern
+
+  /** @brief What each group matched, with [0] the whole match; groups that did not take part are empty with no data. */
+  using Captures = std::array<std::string_view, Groups + 1>;
+
+  /** @return Whether the whole of text matches. */
+  static constexpr bool match(std::string_view text) noexcept { return recognize<true>(text); }
+
+  static constexpr bool match(std::string_view text, Captures& captures) noexcept
+  {
+    if constexpr (Groups == 0)
+    {
+      if (!recognize<true>(text))
+      {
+        return false;
+      }
+      captures[0] = text;
+      return true;
+    }
+    else if constexpr (Deterministic<true> && Dfa<true>.onePass)
+    {
+      return capture(text, captures);
+    }
+    else
+    {
+      return recognize<true>(text) && run<true, true>(text, &captures);
+    }
+  }
+
+  /** @return Whether some part of text matches. */
+  static constexpr bool search(std::string_view text) noexcept { return recognize<false>(text); }
+
+  /** @brief Finds the leftmost match in text. */
+  static constexpr bool search(std::string_view text, Captures& captures) noexcept
+  {
+    return recognize<false>(text) && run<false, true>(text, &captures);
+  }
+
+  /** @brief Matches a Str or other string with data() and size(); captures view its characters. */
+  template <typename TStr>
+  requires requires(const TStr& str) { std::string_view(str.data(), str.size()); }
+  static constexpr bool match(const TStr& text) noexcept { return match(std::string_view(text.data(), text.size())); }
+
+  template <typename TStr>
+  requires requires(const TStr& str) { std::string_view(str.data(), str.size()); }
+  static constexpr bool match(const TStr& text, Captures& captures) noexcept
+  {
+    return match(std::string_view(text.data(), text.size()), captures);
+  }
+
+  template <typename TStr>
+  requires requires(const TStr& str) { std::string_view(str.data(), str.size()); }
+  static constexpr bool search(const TStr& text) noexcept { return search(std::string_view(text.data(), text.size())); }
+
+  template <typename TStr>
+  requires requires(const TStr& str) { std::string_view(str.data(), str.size()); }
+  static constexpr bool search(const TStr& text, Captures& captures) noexcept
+  {
+    return search(std::string_view(text.data(), text.size()), captures);
+  }
+
+private:
+  static constexpr size_t Unset = SIZE_MAX;
+
+  /** @brief The threads alive at one position of the text, in priority order, with their captures if needed. */
+  template <size_t Slots>
+  struct Threads {
+    std::array<uint16_t, Insts>                              pc{};
+    std::array<std::array<size_t, Slots>, Slots ? Insts : 0> slots{};
+    std::array<uint64_t, (Insts + 63) / 64>                  listed{};
+    size_t                                                   count = 0;
+
+    constexpr void clear() noexcept
+    {
+      count  = 0;
+      listed = {};
+    }
+  };
+
+  /** @brief Adds the thread at pc, and through the instructions that do not consume a byte, those it leads to. */
+  template <size_t Slots>
+  static constexpr void add(Threads<Slots>& threads, size_t pc, std::string_view text, size_t pos,
+                            const std::array<size_t, Slots>& slots) noexcept
+  {
+    auto& word = threads.listed[pc / 64];
+    if ((word >> (pc % 64)) & 1)
+    {
+      return;
+    }
+    word |= uint64_t(1) << (pc % 64);
+
+    const auto& inst = Program.code[pc];
+    switch (inst.op)
+    {
+    case detail::RegexOp::Jump: add(threads, inst.x, text, pos, slots); return;
+    case detail::RegexOp::Split:
+      add(threads, inst.x, text, pos, slots);
+      add(threads, inst.y, text, pos, slots);
+      return;
+    case detail::RegexOp::Save:
+      if constexpr (Slots > 0)
+      {
+        auto saved    = slots;
+        saved[inst.x] = pos;
+        add(threads, pc + 1, text, pos, saved);
+      }
+      else
+      {
+        add(threads, pc + 1, text, pos, slots);
+      }
+      return;
+    case detail::RegexOp::Begin:
+      if (pos == 0)
+      {
+        add(threads, pc + 1, text, pos, slots);
+      }
+      return;
+    case detail::RegexOp::End:
+      if (pos == text.size())
+      {
+        add(threads, pc + 1, text, pos, slots);
+      }
+      return;
+    default:
+      threads.pc[threads.count] = static_cast<uint16_t>(pc);
+      if constexpr (Slots > 0)
+      {
+        threads.slots[threads.count] = slots;
+      }
+      ++threads.count;
+      return;
+    }
+  }
+
+  /** @brief Whether text matches, with the DFA if it fits. */
+  template <bool Anchored>
+  static constexpr bool recognize(std::string_view text) noexcept
+  {
+    if constexpr (!Deterministic<Anchored>)
+    {
+      return run<Anchored, false>(text, nullptr);
+    }
+    else
+    {
+      constexpr auto& dfa   = Dfa<Anchored>;
+      size_t          state = 1;
+      for (const auto chr : text)
+      {
+        if (!Anchored && (dfa.accepts[state] & dfa.Matched))
+        {
+          return true;
+        }
+        state = dfa.next[(state * Columns) + dfa.byteClass[static_cast<uint8_t>(chr)]];
+        if (Anchored && (state == 0))
+        {
+          return false;
+        }
+      }
+      return (dfa.accepts[state] & dfa.At_End) != 0;
+    }
+  }
+
+  /** @brief Matches text against a one-pass program with its DFA, setting the slots each transition saves. */
+  static constexpr bool capture(std::string_view text, Captures& captures) noexcept
+  {
+    constexpr auto& dfa = Dfa<true>;
+
+    std::array<size_t, 2 * (Groups + 1)> slots{};
+    slots.fill(Unset);
+    size_t state = 1;
+    for (size_t pos = 0; pos < text.size(); ++pos)
+    {
+      const auto transition = (state * Columns) + dfa.byteClass[static_cast<uint8_t>(text[pos])];
+      save(slots, dfa.saves[transition], pos);
+      state = dfa.next[transition];
+      if (state == 0)
+      {
+        return false;
+      }
+    }
+    if ((dfa.accepts[state] & dfa.At_End) == 0)
+    {
+      return false;
+    }
+    save(slots, dfa.endSaves[state], text.size());
+    toCaptures(text, slots, captures);
+    return true;
+  }
+
+  template <size_t Slots>
+  static constexpr void save(std::array<size_t, Slots>& slots, uint64_t saved, size_t pos) noexcept
+  {
+    for (; saved != 0; saved &= saved - 1)
+    {
+      slots[static_cast<size_t>(std::countr_zero(saved))] = pos;
+    }
+  }
+
+  template <size_t Slots>
+  static constexpr void toCaptures(std::string_view text, const std::array<size_t, Slots>& slots,
+                                   Captures& captures) noexcept
+  {
+    for (size_t group = 0; group <= Groups; ++group)
+    {
+      const auto begin = slots[2 * group];
+      const auto end   = slots[(2 * group) + 1];
+      captures[group]  = ((begin == Unset) || (end == Unset)) ? std::string_view() : text.substr(begin, end - begin);
+    }
+  }
+
+  /** @brief Runs every thread in lockstep over text; Anchored requires the match to span all of it. */
+  template <bool Anchored, bool Capture>
+  static constexpr bool run(std::string_view text, Captures* captures) noexcept
+  {
+    constexpr size_t Slots = Capture ? (2 * (Groups + 1)) : 0;
+
+    Threads<Slots>            lists[2];
+    std::array<size_t, Slots> start{};
+    std::array<size_t, Slots> found{};
+    start.fill(Unset);
+    bool matched = false;
+
+    auto* current = &lists[0];
+    auto* next    = &lists[1];
+    for (size_t pos = 0; pos <= text.size(); ++pos)
+    {
+      if (!matched && (!Anchored || (pos == 0)))
+      {
+        // Lowest priority, so that a match starting earlier wins
+        add(*current, 0, text, pos, start);
+      }
+      if ((current->count == 0) && (Anchored || matched))
+      {
+        break;
+      }
+      next->clear();
+      for (size_t i = 0; i < current->count; ++i)
+      {
+        const auto pc = current->pc[i];
+        if (Program.code[pc].op == detail::RegexOp::Match)
+        {
+          if (Anchored && (pos != text.size()))
+          {
+            continue;
+          }
+          if constexpr (!Capture)
+          {
+            return true;
+          }
+          else
+          {
+            matched = true;
+            found   = current->slots[i];
+            break;  // Threads after this one have lower priority
+          }
+        }
+        if ((pos < text.size()) && Program.consumes(pc, text[pos]))
+        {
+          if constexpr (Capture)
+          {
+            add(*next, pc + 1, text, pos + 1, current->slots[i]);
+          }
+          else
+          {
+            add(*next, pc + 1, text, pos + 1, start);
+          }
+        }
+      }
+      auto* swap = current;
+      current    = next;
+      next       = swap;
+    }
+
+    if constexpr (Capture)
+    {
+      if (matched)
+      {
+        toCaptures(text, found, *captures);
+      }
+    }
+    return matched;
+  }
+};
+
+}  // namespace lil
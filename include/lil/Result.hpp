@@ -0,0 +1,129 @@
+#pragma once
+
+// std
+#include <stdint.h>
+#include <type_traits>
+
+// local
+#include <lil/Err.hpp>
+
+namespace lil {
+
+/** @brief Either a T or the Err explaining why there is no T; an exception-free alternative to out-params.
+ *
+ * Result stays trivially copyable and no larger than needed so that it is returned in registers:
+ * - In general it holds T alongside a 16 bit Err, e.g. Result<uint32_t> is 8 bytes.
+ * - Result<T*> uses the top ERROR_MAX addresses as a niche, so it is exactly pointer sized. Those addresses are never
+ *   valid object addresses on supported targets.
+ * - Result<void> is just an Err.
+ *
+ * Both constructors are implicit so that functions can `return value;` or `return Err::BAD_ALLOC;`.
+ * @code
+ * Result<uint16_t> readAdc();
+ * auto sample = readAdc();
+ * if (!sample.ok()) { return sample.err(); }
+ * @endcode
+ * @tparam T A trivially copyable type other than Err.
+ */
+template <typename T>
+class Result final {
+public:
+  static_assert(std::is_trivially_copyable<T>::value, "Result requires a trivially copyable T");
+  static_assert(!std::is_same<T, Err>::value, "Result<Err> is ambiguous; return Err or Result<void> instead");
+  using value_type = T;
+
+  constexpr Result(T value) noexcept
+      : _value(value)
+      , _err(NONE)
+  {
+  }
+
+  /** @pre err != NONE */
+  constexpr Result(Err err) noexcept
+      : _empty()
+      , _err(static_cast<uint16_t>(err))
+  {
+  }
+
+  constexpr bool ok() const noexcept { return _err == NONE; }
+  constexpr explicit operator bool() const noexcept { return ok(); }
+  constexpr Err err() const noexcept { return static_cast<Err>(_err); }
+
+  /** @pre ok() */
+  constexpr T&       value() noexcept { return _value; }
+  constexpr const T& value() const noexcept { return _value; }
+  constexpr T&       operator*() noexcept { return _value; }
+  constexpr const T& operator*() const noexcept { return _value; }
+  constexpr T*       operator->() noexcept { return &_value; }
+  constexpr const T* operator->() const noexcept { return &_value; }
+
+  /** @brief Returns the value if ok(), else fallback. */
+  constexpr T value_or(T fallback) const noexcept { return ok() ? _value : fallback; }
+
+private:
+  struct Empty {};
+
+  union {
+    Empty _empty;
+    T     _value;
+  };
+  uint16_t _err;
+};
+
+template <typename T>
+class Result<T*> final {
+public:
+  using value_type = T*;
+
+  Result(T* value) noexcept
+      : _bits(reinterpret_cast<uintptr_t>(value))
+  {
+  }
+
+  /** @pre err != NONE */
+  constexpr Result(Err err) noexcept
+      : _bits(uintptr_t(0) - static_cast<uintptr_t>(err))
+  {
+  }
+
+  constexpr bool ok() const noexcept { return _bits <= (uintptr_t(0) - ERROR_MAX); }
+  constexpr explicit operator bool() const noexcept { return ok(); }
+  constexpr Err err() const noexcept { return ok() ? NONE : static_cast<Err>(uintptr_t(0) - _bits); }
+
+  /** @pre ok() */
+  T* value() const noexcept { return reinterpret_cast<T*>(_bits); }
+  T& operator*() const noexcept { return *value(); }
+  T* operator->() const noexcept { return value(); }
+
+  /** @brief Returns the pointer if ok(), else fallback. */
+  T* value_or(T* fallback) const noexcept { return ok() ? value() : fallback; }
+
+private:
+  uintptr_t _bits;  ///< The pointer, or -err.
+};
+
+template <>
+class Result<void> final {
+public:
+  using value_type = void;
+
+  /** @brief Constructs a successful Result. */
+  constexpr Result() noexcept
+      : _err(NONE)
+  {
+  }
+
+  constexpr Result(Err err) noexcept
+      : _err(static_cast<uint16_t>(err))
+  {
+  }
+
+  constexpr bool ok() const noexcept { return _err == NONE; }
+  constexpr explicit operator bool() const noexcept { return ok(); }
+  constexpr Err err() const noexcept { return static_cast<Err>(_err); }
+
+private:
+  uint16_t _err;
+};
+
+}  // namespace lil
@@ -0,0 +1,106 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+// local
+#include <lil/Err.hpp>
+#include <lil/Result.hpp>
+#include <lil/detail/LilConf.h>
+
+namespace lil {
+
+/** @brief Shares a small, read-mostly value, e.g. calibration constants, without making readers take a lock.
+ *
+ * Readers copy the value and retry if a write overlapped the copy, so they never write shared memory and scale with
+ * the number of cores; the writer only bumps a sequence number around its update. The value is stored as 32 bit
+ * atomics, which keeps overlapping copies well defined and needs no locks on 32 bit ARM. Each word is stored with
+ * release and loaded with acquire ordering rather than fenced once, so a reader that sees any word of a write also sees
+ * that write's odd sequence number; on x86 these are plain moves, and thread sanitizers can follow them.
+ *
+ * A reader spinning on a write in progress runs LIL_SPIN_WAIT(), so on a single core RTOS it must let a lower priority
+ * writer finish; ISRs should use tryRead() instead. Use Snapshot where readers must never retry.
+ * @tparam T A trivially copyable type.
+ */
+template <typename T>
+class SeqLock {
+public:
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock requires a trivially copyable T");
+
+  explicit SeqLock(const T& value = T{}) noexcept { store(value, std::memory_order_relaxed); }
+
+  SeqLock(const SeqLock&)            = delete;
+  SeqLock& operator=(const SeqLock&) = delete;
+
+  /** @brief Replaces the value. Writes must not overlap: use a single writer, or serialize writers externally. */
+  void write(const T& value) noexcept
+  {
+    const auto sequence = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    store(value, std::memory_order_release);
+    _sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  /** @return A consistent copy of the value, or Err::RESOURCE_BUSY if a write overlapped the attempt. */
+  Result<T> tryRead() const noexcept
+  {
+    T value;
+    if (!tryCopy(value))
+    {
+      return RESOURCE_BUSY;
+    }
+    return value;
+  }
+
+  /** @brief Returns a consistent copy of the value, retrying while writes overlap. */
+  T read() const noexcept
+  {
+    T value;
+    while (!tryCopy(value))
+    {
+      LIL_SPIN_WAIT();
+    }
+    return value;
+  }
+
+  /** @brief Returns a number that changes with every write(), e.g. to skip work when nothing changed. */
+  uint32_t version() const noexcept { return _sequence.load(std::memory_order_acquire) >> 1; }
+
+private:
+  static constexpr size_t Words = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+  std::atomic<uint32_t> _sequence{ 0 };  ///< Odd while a write is in progress.
+  std::atomic<uint32_t> _words[Words];
+
+  bool tryCopy(T& value) const noexcept
+  {
+    uint32_t   words[Words];
+    const auto before = _sequence.load(std::memory_order_acquire);
+    for (size_t i = 0; i < Words; ++i)
+    {
+      words[i] = _words[i].load(std::memory_order_acquire);
+    }
+    if (((before & 1) != 0) || (_sequence.load(std::memory_order_relaxed) != before))
+    {
+      return false;
+    }
+    memcpy(&value, words, sizeof(T));
+    return true;
+  }
+
+  void store(const T& value, std::memory_order order) noexcept
+  {
+    uint32_t words[Words]{};
+    memcpy(words, &value, sizeof(T));
+    for (size_t i = 0; i < Words; ++i)
+    {
+      _words[i].store(words[i], order);
+    }
+  }
+};
+
+}  // namespace lil
@@ -0,0 +1,86 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+
+// local
+#include <lil/detail/LilConf.h>
+
+namespace lil {
+
+/** @brief Shares a read-mostly value between contexts, giving readers wait-free, consistent copies.
+ *
+ * The value is double buffered: readers copy the live buffer while the writer fills the other one and then swaps them.
+ * Each reader announces itself on one of two counters first, which is how the writer tells when the last reader of
+ * the old buffer has left (the Left-Right technique). Readers therefore finish in a bounded number of steps, unlike
+ * SeqLock readers, at the cost of an atomic increment and decrement per read.
+ *
+ * The writer waits for stragglers only when it publishes again before readers of the value before last have finished
+ * their copy, running LIL_SPIN_WAIT() meanwhile. On a single core RTOS the writer must therefore not preempt readers,
+ * e.g. a low priority configuration task writing for high priority control loops.
+ * @tparam T A trivially copyable type.
+ */
+template <typename T>
+class Snapshot {
+public:
+  static_assert(std::is_trivially_copyable<T>::value, "Snapshot requires a trivially copyable T");
+
+  explicit Snapshot(const T& value = T{}) noexcept
+      : _buffers{ value, value }
+  {
+  }
+
+  Snapshot(const Snapshot&)            = delete;
+  Snapshot& operator=(const Snapshot&) = delete;
+
+  /** @brief Returns a copy of the most recently published value. Wait-free. */
+  T read() const noexcept
+  {
+    const auto version = _version.load(std::memory_order_seq_cst);
+    _readers[version].fetch_add(1, std::memory_order_seq_cst);
+    const T value = _buffers[_live.load(std::memory_order_seq_cst)];
+    _readers[version].fetch_sub(1, std::memory_order_release);
+    return value;
+  }
+
+  /** @brief Makes value visible to subsequent reads. Writes must not overlap: use a single writer, or serialize
+   * writers externally.
+   */
+  void publish(const T& value) noexcept
+  {
+    const auto live = _live.load(std::memory_order_relaxed);
+    drain();
+    _buffers[live ^ 1] = value;
+    _live.store(live ^ 1, std::memory_order_seq_cst);
+  }
+
+private:
+  T                             _buffers[2];
+  std::atomic<uint32_t>         _live{ 0 };     ///< Index of the buffer readers copy.
+  std::atomic<uint32_t>         _version{ 0 };  ///< Index of the counter new readers announce themselves on.
+  mutable std::atomic<uint32_t> _readers[2]{};
+
+  /** @brief Waits until no reader that could have seen the buffer before the last publish() is still copying it.
+   * Draining one counter, switching new readers to it and then draining the other covers readers that announced
+   * themselves just before the switch.
+   */
+  void drain() noexcept
+  {
+    const auto version = _version.load(std::memory_order_relaxed);
+    wait(_readers[version ^ 1]);
+    _version.store(version ^ 1, std::memory_order_seq_cst);
+    wait(_readers[version]);
+  }
+
+  static void wait(const std::atomic<uint32_t>& readers) noexcept
+  {
+    while (readers.load(std::memory_order_acquire) != 0)
+    {
+      LIL_SPIN_WAIT();
+    }
+  }
+};
+
+}  // namespace lil
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <type_traits>
 
 // local
 #include <lil/Assert.hpp>
@@ -13,6 +14,117 @@
 
 namespace lil {
 
+namespace detail {
+/** @brief The algorithms behind every Str<Size>, on a character array and its capacity, so Size only changes the data.
+ *
+ * data holds up to capacity characters, then the null terminator, with data[capacity] counting the unused characters.
+ * The algorithms are constexpr for constant evaluation only: at runtime Str calls the out-of-line copies below, so each
+ * exists once in an image however many sizes of Str it uses, and an edit costs a Str one call.
+ */
+struct StrCore {
+  static constexpr size_t size(const char* data, size_t capacity) noexcept
+  {
+    return capacity - static_cast<uint8_t>(data[capacity]);
+  }
+
+  static constexpr void setSize(char* data, size_t capacity, size_t size) noexcept
+  {
+    data[capacity] = static_cast<char>(capacity - size);
+    data[size]     = '\0';
+  }
+
+  /** @brief Returns the length of str, up to max. Scans a character at a time at runtime too: max is a Str capacity,
+   * under 255, and memchr or strnlen with a bound beyond a shorter literal trips -Wstringop-overread once inlined.
+   */
+  static constexpr size_t length(const char* str, size_t max) noexcept
+  {
+    size_t length = 0;
+    for (; (length < max) && (str[length] != '\0'); ++length)
+    {
+    }
+    return length;
+  }
+
+  /** @brief Copies count characters from src, which may overlap dst when it is a Str's own data. */
+  static constexpr void copy(char* dst, const char* src, size_t count) noexcept
+  {
+    if (!std::is_constant_evaluated())
+    {
+      memmove(dst, src, count);
+      return;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+      dst[i] = src[i];
+    }
+  }
+
+  /** @brief Moves count characters within data from index from to index to. */
+  static constexpr void shift(char* data, size_t from, size_t to, size_t count) noexcept
+  {
+    if (!std::is_constant_evaluated() || (to < from))
+    {
+      copy(&data[to], &data[from], count);
+      return;
+    }
+    for (size_t i = count; i-- > 0;)
+    {
+      data[to + i] = data[from + i];
+    }
+  }
+
+  /** @brief Replaces the contents with the first count characters of str, or as many as fit. */
+  static constexpr void assign(char* data, size_t capacity, const char* str, size_t count) noexcept
+  {
+    const auto assigned = length(str, minimum(count, capacity));
+    copy(data, str, assigned);
+    setSize(data, capacity, assigned);
+  }
+
+  /** @brief Inserts count fill characters at index, truncating whatever is pushed beyond capacity. */
+  static constexpr void insert(char* data, size_t capacity, size_t index, size_t count, char fill) noexcept
+  {
+    const auto before    = size(data, capacity);
+    const auto position  = minimum(index, before);
+    const auto inserted  = minimum(count, capacity - position);
+    const auto remaining = minimum(before - position, capacity - position - inserted);
+    shift(data, position, position + inserted, remaining);
+    for (size_t i = 0; i < inserted; ++i)
+    {
+      data[position + i] = fill;
+    }
+    setSize(data, capacity, position + inserted + remaining);
+  }
+
+  /** @brief Inserts the first count characters of str at index, truncating whatever is pushed beyond capacity. */
+  static constexpr void insert(char* data, size_t capacity, size_t index, const char* str, size_t count) noexcept
+  {
+    const auto before    = size(data, capacity);
+    const auto position  = minimum(index, before);
+    const auto inserted  = minimum(count, capacity - position);
+    const auto remaining = minimum(before - position, capacity - position - inserted);
+    shift(data, position, position + inserted, remaining);
+    copy(&data[position], str, inserted);
+    setSize(data, capacity, position + inserted + remaining);
+  }
+
+  /** @brief Removes up to count characters from index. */
+  static constexpr void erase(char* data, size_t capacity, size_t index, size_t count) noexcept
+  {
+    const auto before   = size(data, capacity);
+    const auto position = minimum(index, before);
+    const auto erased   = minimum(count, before - position);
+    shift(data, position + erased, position, before - position - erased);
+    setSize(data, capacity, before - erased);
+  }
+};
+
+void strAssign(char* data, size_t capacity, const char* str, size_t count) noexcept;
+void strInsert(char* data, size_t capacity, size_t index, size_t count, char fill) noexcept;
+void strInsert(char* data, size_t capacity, size_t index, const char* str, size_t count) noexcept;
+void strErase(char* data, size_t capacity, size_t index, size_t count) noexcept;
+}  // namespace detail
+
 struct AtCompileTime {
 };
 
@@ -32,10 +144,7 @@ class Str : public IArr<Str<Size>, char> {
   /** @brief scoobity */
   Str(const char* str, size_t sz = MAX_CHARS)
   {
-    auto input_size     = Str::len(str, sz);
-    auto truncated_size = (input_size < MAX_CHARS ? input_size : MAX_CHARS);
-    memcpy(_data, str, truncated_size);
-    set_size_unsafe(truncated_size);
+    detail::strAssign(_data, MAX_CHARS, str, sz);
   }
 
   constexpr Str(const char (&literal)[Size], AtCompileTime)
@@ -80,50 +189,54 @@ class Str : public IArr<Str<Size>, char> {
     set_size_unsafe(0);
   }
 
+  /** Replaces the contents with the first @p count characters of @p str, up to a null terminator, truncating those
+   * that do not fit.
+   */
+  constexpr Str& assign(const char* str, size_t count)
+  {
+    if (std::is_constant_evaluated())
+    {
+      detail::StrCore::assign(_data, MAX_CHARS, str, count);
+    }
+    else
+    {
+      detail::strAssign(_data, MAX_CHARS, str, count);
+    }
+    return *this;
+  }
+
   /** Inserts @p count @p fill characters starting at @p index. Shifts all other characters right. If insertion overflows, the rightmost characters are truncated.
    * @snippet test_string.cpp Inserting fitting chars
    * @snippet test_string.cpp Inserting overflowing chars
    */
   constexpr Str& insert(size_t index, size_t count, char fill)
   {
-    auto appended_size  = size() + count;
-    auto truncated_size = (appended_size < MAX_CHARS ? appended_size : MAX_CHARS);
-
-    for (size_t i = truncated_size; i >= (index + count); --i)
+    if (std::is_constant_evaluated())
     {
-      _data[i] = _data[i - count];
+      detail::StrCore::insert(_data, MAX_CHARS, index, count, fill);
     }
-
-    for (size_t i = 0; (i < count) && ((index + i) < MAX_CHARS); ++i)
+    else
     {
-      _data[index + i] = fill;
+      detail::strInsert(_data, MAX_CHARS, index, count, fill);
     }
-
-    set_size_unsafe(truncated_size);
     return *this;
   }
 
   constexpr Str& insert(size_t index, const char* str)
   {
-    const auto count = Str::len(str, MAX_CHARS);
-    return insert(index, str, count);
+    return insert(index, str, detail::StrCore::length(str, MAX_CHARS));
   }
 
   constexpr Str& insert(size_t index, const char* str, size_t count)
   {
-    auto insertion_point = minimum(index, size());
-    auto insertion_size  = minimum(count, MAX_CHARS - insertion_point);
-    auto move_size       = size() - insertion_point;
-    if (move_size + insertion_size > MAX_CHARS)
+    if (std::is_constant_evaluated())
     {
-      move_size -= insertion_size;
+      detail::StrCore::insert(_data, MAX_CHARS, index, str, count);
+    }
+    else
+    {
+      detail::strInsert(_data, MAX_CHARS, index, str, count);
     }
-
-    memmove(&_data[insertion_point + insertion_size], &_data[insertion_point], move_size);
-    memcpy(&_data[insertion_point], str, insertion_size);
-
-    auto appended_size = minimum(size() + insertion_size, MAX_CHARS);
-    set_size_unsafe(appended_size);
     return *this;
   }
 
@@ -133,23 +246,26 @@ class Str : public IArr<Str<Size>, char> {
     return insert(index, str.data(), str.size());
   }
 
-  constexpr Str& append(size_t count, char fill) { return insert(size(), count, fill); }
-  constexpr Str& append(const char* str) { return insert(size(), str); }
-  constexpr Str& append(const char* str, size_t count) { return insert(size(), str, count); }
+  // insert() clamps the index to size(), so appending need not load the size first
+  constexpr Str& append(size_t count, char fill) { return insert(MAX_CHARS, count, fill); }
+  constexpr Str& append(const char* str) { return insert(MAX_CHARS, str); }
+  constexpr Str& append(const char* str, size_t count) { return insert(MAX_CHARS, str, count); }
   template <typename TStr>
   constexpr Str& append(const TStr& str)
   {
-    return insert(size(), str);
+    return insert(MAX_CHARS, str);
   }
 
   constexpr Str& erase(size_t index, size_t count)
   {
-    auto erase_point = minimum(index, size());
-    auto erase_size  = minimum(count, size() - index);
-    auto move_size   = size() - erase_point - erase_size;
-    memmove(&_data[erase_point], &_data[erase_point + erase_size], move_size);
-    modify_size(-erase_size);
-
+    if (std::is_constant_evaluated())
+    {
+      detail::StrCore::erase(_data, MAX_CHARS, index, count);
+    }
+    else
+    {
+      detail::strErase(_data, MAX_CHARS, index, count);
+    }
     return *this;
   }
 
@@ -171,7 +287,7 @@ class Str : public IArr<Str<Size>, char> {
   constexpr size_t      size() const noexcept { return max_size() - available(); }  ///< Number of characters in the string. This excludes final null-terminator.
   constexpr size_t      max_size() const noexcept { return MAX_CHARS; }
   constexpr size_t      capacity() const noexcept { return MAX_CHARS; }
-  constexpr size_t      available() const noexcept { return _data[MAX_CHARS]; }
+  constexpr size_t      available() const noexcept { return static_cast<uint8_t>(_data[MAX_CHARS]); }
 
   static inline constexpr char* cpy(char* dst, const char* src, size_t n)
   {
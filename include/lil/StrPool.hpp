@@ -0,0 +1,234 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+// local
+#include <lil/Binary.hpp>
+#include <lil/Err.hpp>
+#include <lil/Hash.hpp>
+#include <lil/Result.hpp>
+#include <lil/Str.hpp>
+
+/** @file
+ * Interned strings: each distinct name is stored once, and records hold a StrId of one or two bytes instead of a Str.
+ *
+ * A StrPool keeps its strings back to back in one arena, each as a length byte, the characters and a null terminator,
+ * and finds them again through an open addressing index of FNV-1a hashes. Handles from the same pool are equal exactly
+ * when their strings are, so comparing and hashing them are integer operations.
+ *
+ * Names known up front can be interned at compile time: a pool constructed from str_literal keys in a constant
+ * expression already holds them, and find() on it yields their IDs as constants. Copy it into a mutable pool to
+ * intern more names at runtime under the same IDs.
+ * @code
+ * constexpr StrPool<64, 1024> Units_Seed{ str_literal("m/s"), str_literal("degC") };
+ * constexpr auto              Celsius = Units_Seed.find(str_literal("degC")).value();
+ * constinit StrPool<64, 1024> units   = Units_Seed;
+ *
+ * record.unit = *units.intern(parsedUnit);  // Celsius if parsedUnit is "degC"
+ * @endcode
+ */
+
+namespace lil {
+
+/** @brief A string interned in a StrPool of up to Strings strings; equal handles from one pool mean equal strings. */
+template <size_t Strings>
+struct StrId {
+  using value_type = BitsToUInt_t<bitsToRepresent(Strings)>;
+
+  value_type index;  ///< Position in interning order; doubles as the handle's hash.
+
+  constexpr bool operator==(const StrId& other) const noexcept { return index == other.index; }
+  constexpr bool operator!=(const StrId& other) const noexcept { return index != other.index; }
+};
+
+namespace detail {
+/** @brief Loads a value that other threads may be writing; plainly during constant evaluation. */
+template <typename T>
+constexpr T poolLoad(const T& value, std::memory_order order) noexcept
+{
+  if (std::is_constant_evaluated())
+  {
+    return value;
+  }
+  return std::atomic_ref<T>(const_cast<T&>(value)).load(order);
+}
+
+/** @brief Stores a value that other threads may be reading; plainly during constant evaluation. */
+template <typename T>
+constexpr void poolStore(T& object, T value, std::memory_order order) noexcept
+{
+  if (std::is_constant_evaluated())
+  {
+    object = value;
+    return;
+  }
+  std::atomic_ref<T>(object).store(value, order);
+}
+
+/** @brief Not constexpr, so that keys which do not fit a StrPool built at compile time fail to compile. */
+inline void strPoolKeysDoNotFit() noexcept
+{
+}
+}  // namespace detail
+
+/** @brief A fixed capacity, deduplicating store of up to Strings strings totalling about ArenaBytes.
+ *
+ * One context at a time may intern(); any number may concurrently find() and read interned strings, lock-free. A
+ * string is published only once it is fully written, so a lookup that races with its interning either misses it or
+ * sees all of it. Nothing is ever removed.
+ * @tparam Strings Maximum number of distinct strings.
+ * @tparam ArenaBytes Storage for them; each takes its length plus 2 bytes.
+ */
+template <size_t Strings, size_t ArenaBytes>
+class StrPool {
+public:
+  static_assert(Strings > 0, "StrPool must hold at least one string");
+  static_assert(ArenaBytes > 0, "StrPool must have an arena");
+
+  using Id = StrId<Strings>;
+
+  static constexpr size_t Max_Length = UINT8_MAX;  ///< Longest string that can be interned.
+
+  constexpr StrPool() noexcept = default;
+
+  /** @brief Interns keys in order, so that the first gets index 0 and so on. In a constant expression, keys that do
+   * not fit are a compile error.
+   */
+  template <uint8_t... Sizes>
+  constexpr explicit StrPool(const Str<Sizes>&... keys) noexcept
+  {
+    if (!(intern(keys) && ...))
+    {
+      detail::strPoolKeysDoNotFit();
+    }
+  }
+
+  /** @brief Returns the ID of the first length characters of text, adding them to the pool if new.
+   * @return Err::INVALID_ARGUMENT if length exceeds Max_Length, Err::RESOURCE_FULL if the string is new and Strings
+   * strings or ArenaBytes are already used.
+   */
+  constexpr Result<Id> intern(const char* text, size_t length) noexcept
+  {
+    if (length > Max_Length)
+    {
+      return INVALID_ARGUMENT;
+    }
+    auto slot = fnv1a(text, length) & Mask;
+    for (;; slot = (slot + 1) & Mask)
+    {
+      const auto entry = detail::poolLoad(_slots[slot], std::memory_order_relaxed);
+      if (entry == 0)
+      {
+        break;
+      }
+      if (equals(entry - 1, text, length))
+      {
+        return Id{ static_cast<index_type>(entry - 1) };
+      }
+    }
+
+    const auto count = detail::poolLoad(_size, std::memory_order_relaxed);
+    if ((count == Strings) || ((ArenaBytes - _used) < (length + 2)))
+    {
+      return RESOURCE_FULL;
+    }
+    _arena[_used] = static_cast<char>(length);
+    std::char_traits<char>::copy(&_arena[_used + 1], text, length);
+    _arena[_used + 1 + length] = '\0';
+    _offsets[count]            = static_cast<offset_type>(_used);
+    _used += length + 2;
+    detail::poolStore(_size, static_cast<index_type>(count + 1), std::memory_order_release);
+    // Publishes the characters and offset written above to concurrent find()
+    detail::poolStore(_slots[slot], static_cast<index_type>(count + 1), std::memory_order_release);
+    return Id{ count };
+  }
+
+  constexpr Result<Id> intern(const char* text) noexcept { return intern(text, std::char_traits<char>::length(text)); }
+
+  template <uint8_t Size>
+  constexpr Result<Id> intern(const Str<Size>& str) noexcept
+  {
+    return intern(str.data(), str.size());
+  }
+
+  /** @brief Returns the ID of the first length characters of text without adding them. Safe from any thread.
+   * @return Err::INVALID_ARGUMENT if they have not been interned.
+   */
+  constexpr Result<Id> find(const char* text, size_t length) const noexcept
+  {
+    if (length > Max_Length)
+    {
+      return INVALID_ARGUMENT;
+    }
+    for (auto slot = fnv1a(text, length) & Mask;; slot = (slot + 1) & Mask)
+    {
+      const auto entry = detail::poolLoad(_slots[slot], std::memory_order_acquire);
+      if (entry == 0)
+      {
+        return INVALID_ARGUMENT;
+      }
+      if (equals(entry - 1, text, length))
+      {
+        return Id{ static_cast<index_type>(entry - 1) };
+      }
+    }
+  }
+
+  constexpr Result<Id> find(const char* text) const noexcept
+  {
+    return find(text, std::char_traits<char>::length(text));
+  }
+
+  template <uint8_t Size>
+  constexpr Result<Id> find(const Str<Size>& str) const noexcept
+  {
+    return find(str.data(), str.size());
+  }
+
+  /** @brief Returns the null terminated text of id, which lives as long as the pool. @pre id came from this pool */
+  constexpr const char* c_str(Id id) const noexcept { return &_arena[_offsets[id.index] + 1]; }
+
+  /** @pre id came from this pool */
+  constexpr size_t length(Id id) const noexcept { return static_cast<uint8_t>(_arena[_offsets[id.index]]); }
+
+  constexpr size_t size() const noexcept { return detail::poolLoad(_size, std::memory_order_acquire); }
+  constexpr size_t capacity() const noexcept { return Strings; }
+  constexpr size_t bytesUsed() const noexcept { return _used; }  ///< Arena bytes used; only valid in the interning context.
+
+private:
+  using index_type  = typename Id::value_type;
+  using offset_type = BitsToUInt_t<bitsToRepresent(ArenaBytes)>;
+
+  /** @brief Index slots: a power of two at least twice Strings, so probe sequences stay short and always end. */
+  static constexpr size_t Slots = size_t(1) << bitsToRepresent((2 * Strings) - 1);
+  static constexpr size_t Mask  = Slots - 1;
+
+  static_assert(Strings <= std::numeric_limits<index_type>::max(), "StrId must represent Strings + 1 values");
+
+  char        _arena[ArenaBytes]{};
+  offset_type _offsets[Strings]{};  ///< Where each string's length byte is, in interning order.
+  index_type  _slots[Slots]{};      ///< Index + 1 of the string hashing here, or 0 if free.
+  index_type  _size = 0;
+  size_t      _used = 0;  ///< Arena bytes used; owned by the interning context.
+
+  constexpr bool equals(size_t index, const char* text, size_t length) const noexcept
+  {
+    const auto offset = _offsets[index];
+    return (static_cast<uint8_t>(_arena[offset]) == length) &&
+           (std::char_traits<char>::compare(&_arena[offset + 1], text, length) == 0);
+  }
+};
+
+}  // namespace lil
+
+template <size_t Strings>
+struct std::hash<lil::StrId<Strings>> {
+  size_t operator()(lil::StrId<Strings> id) const noexcept { return id.index; }
+};
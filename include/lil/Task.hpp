@@ -0,0 +1,454 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <coroutine>
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/Err.hpp>
+#include <lil/Result.hpp>
+#include <lil/detail/LilConf.h>
+
+/** @file
+ * Cooperative coroutines for protocol state machines, without a heap.
+ *
+ * Coroutine frames come from a fixed pool of LIL_TASK_FRAMES blocks of LIL_TASK_FRAME_BYTES; a coroutine whose frame
+ * does not fit, or that finds the pool exhausted, yields Err::BAD_ALLOC instead of throwing. Tasks are lazy: they run
+ * when co_awaited by another task or when spawned on an Executor, which resumes them from a single thread when the
+ * event, ring or deadline they wait for is ready.
+ * @code
+ * Task<uint8_t> readByte(ByteRing<64>& rx)
+ * {
+ *   if (auto ready = co_await readable(rx, 1, 100); !ready) { co_return ready.err(); }  // OPERATION_TIMED_OUT
+ *   uint8_t byte;
+ *   rx.read(&byte, 1);
+ *   co_return byte;
+ * }
+ * @endcode
+ */
+
+namespace lil {
+
+constexpr uint32_t Forever = UINT32_MAX;  ///< A timeout that never expires.
+
+class Event;
+class Executor;
+
+/** @brief A fixed number of equally sized blocks, handed out in O(1) without fragmentation.
+ *
+ * Thread-safe, as executors on several threads share taskFramePool(): a short spin lock guards the free list, and a
+ * context that finds it held runs LIL_SPIN_WAIT() so that a lower priority holder can finish. Not for use from ISRs.
+ */
+template <size_t BlockBytes, size_t Blocks>
+class FramePool {
+public:
+  constexpr FramePool() noexcept = default;
+
+  FramePool(const FramePool&)            = delete;
+  FramePool& operator=(const FramePool&) = delete;
+
+  /** @return A block of at least size bytes, or nullptr if size is too large or every block is in use. */
+  void* allocate(size_t size) noexcept
+  {
+    if (size > BlockBytes)
+    {
+      return nullptr;
+    }
+    lock();
+    Block* block = _free;
+    if (block != nullptr)
+    {
+      _free = block->next;
+    }
+    else if (_untouched < Blocks)
+    {
+      block = &_blocks[_untouched++];
+    }
+    _used += (block != nullptr) ? 1 : 0;
+    unlock();
+    return block;
+  }
+
+  /** @pre block came from allocate() on this pool. */
+  void deallocate(void* block) noexcept
+  {
+    lock();
+    static_cast<Block*>(block)->next = _free;
+    _free                            = static_cast<Block*>(block);
+    --_used;
+    unlock();
+  }
+
+  size_t           used() const noexcept { return _used; }
+  constexpr size_t capacity() const noexcept { return Blocks; }
+
+private:
+  union alignas(alignof(max_align_t)) Block {
+    Block*  next;
+    uint8_t bytes[BlockBytes];
+  };
+
+  Block            _blocks[Blocks]{};
+  Block*           _free      = nullptr;
+  size_t           _untouched = 0;  ///< Blocks beyond this index have never been allocated, so needn't be linked.
+  size_t           _used      = 0;
+  std::atomic_flag _locked    = ATOMIC_FLAG_INIT;
+
+  void lock() noexcept
+  {
+    while (_locked.test_and_set(std::memory_order_acquire))
+    {
+      LIL_SPIN_WAIT();
+    }
+  }
+
+  void unlock() noexcept { _locked.clear(std::memory_order_release); }
+};
+
+using TaskFramePool = FramePool<LIL_TASK_FRAME_BYTES, LIL_TASK_FRAMES>;
+
+/** @brief Returns the pool every Task frame is allocated from. */
+TaskFramePool& taskFramePool() noexcept;
+
+namespace detail {
+/** @brief A suspended coroutine and what it waits for; lives in the awaiter, i.e. in the coroutine frame. */
+struct Waiter {
+  std::coroutine_handle<> handle;
+  Executor*               executor  = nullptr;
+  Waiter*                 next      = nullptr;  ///< Link in the ready queue, an Event's list or the polled list.
+  Waiter*                 nextTimer = nullptr;  ///< Link in the timer list, sorted by deadline.
+  Event*                  event     = nullptr;  ///< Event waited on, if any.
+  bool                    (*ready)(const void*, size_t) = nullptr;  ///< Polled readiness check, if any.
+  const void*             context   = nullptr;
+  size_t                  argument  = 0;
+  uint32_t                deadline  = 0;
+  bool                    timed     = false;
+  Err                     expired   = OPERATION_TIMED_OUT;  ///< Result when the deadline passes.
+  Err                     result    = NONE;
+};
+
+struct PromiseBase {
+  Executor*               executor = nullptr;
+  std::coroutine_handle<> continuation;  ///< Awaiting task, resumed on completion.
+  Waiter                  root;          ///< Schedules the task when spawned.
+  bool                    detached = false;
+
+  static void* operator new(size_t size) noexcept { return taskFramePool().allocate(size); }
+  static void  operator delete(void* frame) noexcept { taskFramePool().deallocate(frame); }
+
+  std::suspend_always initial_suspend() noexcept { return {}; }
+
+  struct FinalAwaiter {
+    bool await_ready() noexcept { return false; }
+    void await_resume() noexcept {}
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+    {
+      return handle.promise().finish(handle);
+    }
+  };
+
+  FinalAwaiter final_suspend() noexcept { return {}; }
+
+  /** @brief Continues whatever awaited the task; destroys frame if nothing owns it. */
+  std::coroutine_handle<> finish(std::coroutine_handle<> frame) noexcept;
+};
+
+template <typename T>
+struct TaskPromise : PromiseBase {
+  Result<T> result = ILLEGAL_STATE;  ///< Until the task returns.
+
+  void return_value(Result<T> value) noexcept { result = value; }
+  void unhandled_exception() noexcept { result = OPERATION_ABORTED; }
+};
+
+template <>
+struct TaskPromise<void> : PromiseBase {
+  Result<void> result = ILLEGAL_STATE;
+
+  void return_void() noexcept { result = Result<void>(); }
+  void unhandled_exception() noexcept { result = OPERATION_ABORTED; }
+};
+
+template <typename TaskPromise>
+struct TaskAwaiter {
+  std::coroutine_handle<TaskPromise> task;
+
+  bool await_ready() noexcept { return task == nullptr; }
+
+  template <typename Promise>
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept
+  {
+    task.promise().continuation = awaiting;
+    task.promise().executor     = awaiting.promise().executor;
+    return task;
+  }
+
+  auto await_resume() noexcept
+  {
+    return (task == nullptr) ? decltype(task.promise().result)(BAD_ALLOC) : task.promise().result;
+  }
+};
+}  // namespace detail
+
+/** @brief A lazily started coroutine that produces Result<T>; co_return either a T or an Err.
+ *
+ * co_await on a Task runs it to completion and yields its Result<T>, or Err::BAD_ALLOC if its frame could not be
+ * allocated. An exception that escapes a task ends it with Err::OPERATION_ABORTED, which its awaiter sees like any
+ * other error. A Task owns its frame until it is spawned as a temporary on an Executor.
+ */
+template <typename T>
+class [[nodiscard]] Task {
+public:
+  struct promise_type : detail::TaskPromise<T> {
+    Task get_return_object() noexcept
+    {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    static Task get_return_object_on_allocation_failure() noexcept { return Task(nullptr); }
+  };
+
+  Task(Task&& other) noexcept
+      : _handle(other._handle)
+  {
+    other._handle = nullptr;
+  }
+
+  Task& operator=(Task&& other) noexcept
+  {
+    if (this != &other)
+    {
+      reset();
+      _handle       = other._handle;
+      other._handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~Task() { reset(); }
+
+  /** @brief Returns whether the task has finished, including if it could never start. */
+  bool done() const noexcept { return (_handle == nullptr) || _handle.done(); }
+
+  /** @brief Returns the task's result, Err::BAD_ALLOC if its frame could not be allocated, Err::OPERATION_ABORTED if
+   * an exception escaped it, e.g. from a throwing AssertFail(), or ILLEGAL_STATE if it has not finished.
+   */
+  Result<T> result() const noexcept
+  {
+    return (_handle == nullptr) ? Result<T>(BAD_ALLOC) : _handle.promise().result;
+  }
+
+  detail::TaskAwaiter<promise_type> operator co_await() && noexcept { return { _handle }; }
+
+private:
+  friend class Executor;
+
+  std::coroutine_handle<promise_type> _handle;
+
+  explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+      : _handle(handle)
+  {
+  }
+
+  void reset() noexcept
+  {
+    if (_handle != nullptr)
+    {
+      _handle.destroy();
+      _handle = nullptr;
+    }
+  }
+};
+
+/** @brief Runs tasks cooperatively on the thread that calls run() or runOnce().
+ *
+ * Time is measured in ticks of a caller supplied clock, e.g. milliseconds, and compared modulo 2^32 so the clock may
+ * wrap. Nothing here may be touched from another thread or ISR; signal the executor thread by writing to a ByteRing or
+ * an atomic and awaiting it with readable() or waitUntil().
+ */
+class Executor {
+public:
+  using Clock = uint32_t (*)() noexcept;
+
+  explicit Executor(Clock clock) noexcept
+      : _clock(clock)
+  {
+  }
+
+  Executor(const Executor&)            = delete;
+  Executor& operator=(const Executor&) = delete;
+
+  /** @brief Schedules task; the caller keeps ownership and must keep it alive until task.done().
+   * @return Err::BAD_ALLOC if the task's frame could not be allocated.
+   */
+  template <typename T>
+  Err spawn(Task<T>& task) noexcept
+  {
+    return start(task._handle, task._handle ? &task._handle.promise() : nullptr, false);
+  }
+
+  /** @brief Schedules task and frees its frame when it finishes. */
+  template <typename T>
+  Err spawn(Task<T>&& task) noexcept
+  {
+    const auto handle = task._handle;
+    task._handle      = nullptr;
+    return start(handle, handle ? &handle.promise() : nullptr, true);
+  }
+
+  /** @brief Resumes every task that was ready when called, after waking tasks whose wait is over.
+   * @return The number of tasks resumed.
+   */
+  size_t runOnce() noexcept;
+
+  /** @brief Calls runOnce() until every spawned task has finished, running LIL_TASK_IDLE(idleTicks()) between passes
+   * that leave no task ready rather than spinning through delays and timeouts.
+   */
+  void run() noexcept;
+
+  /** @brief Returns the number of spawned tasks that have not finished. */
+  size_t tasks() const noexcept { return _tasks; }
+
+  uint32_t now() const noexcept { return _clock(); }
+
+  /** @brief Returns the ticks until the earliest deadline, 0 if a task is ready, or Forever if nothing is pending. */
+  uint32_t idleTicks() const noexcept;
+
+  // Used by awaitables.
+  void wait(detail::Waiter& waiter, uint32_t timeout) noexcept;
+  void wake(detail::Waiter& waiter, Err result) noexcept;
+
+private:
+  friend struct detail::PromiseBase;
+
+  Clock           _clock;
+  detail::Waiter* _ready     = nullptr;
+  detail::Waiter* _readyTail = nullptr;
+  detail::Waiter* _timers    = nullptr;
+  detail::Waiter* _polled    = nullptr;
+  size_t          _tasks     = 0;
+
+  Err  start(std::coroutine_handle<> handle, detail::PromiseBase* promise, bool detached) noexcept;
+  void schedule(detail::Waiter& waiter) noexcept;
+};
+
+/** @brief A flag that tasks can wait on; set() wakes every waiter. Only use from the executor's thread. */
+class Event {
+public:
+  constexpr Event() noexcept = default;
+
+  Event(const Event&)            = delete;
+  Event& operator=(const Event&) = delete;
+
+  void set() noexcept;
+  void reset() noexcept { _set = false; }
+  bool isSet() const noexcept { return _set; }
+
+  /** @brief co_await to suspend until set(); yields Err::OPERATION_TIMED_OUT if timeout ticks pass first. */
+  auto wait(uint32_t timeout = Forever) noexcept;
+
+private:
+  friend class Executor;
+
+  bool            _set     = false;
+  detail::Waiter* _waiters = nullptr;
+};
+
+namespace detail {
+/** @brief Suspends until woken by the executor and yields Result<void>; derived classes say what wakes them. */
+struct WaitAwaiter {
+  Waiter   waiter;
+  uint32_t timeout;
+
+  Result<void> await_resume() noexcept { return waiter.result; }
+
+  template <typename Promise>
+  void enqueue(std::coroutine_handle<Promise> handle) noexcept
+  {
+    waiter.handle   = handle;
+    waiter.executor = handle.promise().executor;
+    waiter.executor->wait(waiter, timeout);
+  }
+};
+
+struct DelayAwaiter : WaitAwaiter {
+  bool await_ready() noexcept { return false; }
+
+  template <typename Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) noexcept
+  {
+    waiter.expired = NONE;
+    enqueue(handle);
+  }
+};
+
+struct EventAwaiter : WaitAwaiter {
+  Event& event;
+
+  bool await_ready() noexcept { return event.isSet(); }
+
+  template <typename Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) noexcept
+  {
+    waiter.event = &event;
+    enqueue(handle);
+  }
+};
+
+struct PollAwaiter : WaitAwaiter {
+  bool await_ready() noexcept { return waiter.ready(waiter.context, waiter.argument); }
+
+  template <typename Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) noexcept
+  {
+    enqueue(handle);
+  }
+};
+}  // namespace detail
+
+inline auto Event::wait(uint32_t timeout) noexcept
+{
+  return detail::EventAwaiter{ { {}, timeout }, *this };
+}
+
+/** @brief co_await to suspend for ticks; always yields success. */
+inline detail::DelayAwaiter delay(uint32_t ticks) noexcept
+{
+  return detail::DelayAwaiter{ { {}, ticks } };
+}
+
+/** @brief co_await to let every other ready task run first. */
+inline detail::DelayAwaiter yield() noexcept
+{
+  return delay(0);
+}
+
+/** @brief co_await to suspend until ready() returns true, checked on every runOnce(); yields Err::OPERATION_TIMED_OUT if
+ * timeout ticks pass first. Suits state written by ISRs or other threads.
+ * @param ready A callable, kept by reference, e.g. a lambda written in the co_await expression.
+ */
+template <typename Predicate>
+detail::PollAwaiter waitUntil(const Predicate& ready, uint32_t timeout = Forever) noexcept
+{
+  detail::PollAwaiter awaiter{ { {}, timeout } };
+  awaiter.waiter.ready   = [](const void* context, size_t) { return (*static_cast<const Predicate*>(context))(); };
+  awaiter.waiter.context = &ready;
+  return awaiter;
+}
+
+/** @brief co_await to suspend until ring holds at least bytes bytes, e.g. a ByteRing filled by an ISR. */
+template <typename Ring>
+detail::PollAwaiter readable(const Ring& ring, size_t bytes = 1, uint32_t timeout = Forever) noexcept
+{
+  detail::PollAwaiter awaiter{ { {}, timeout } };
+  awaiter.waiter.ready    = [](const void* context, size_t count) { return static_cast<const Ring*>(context)->size() >= count; };
+  awaiter.waiter.context  = &ring;
+  awaiter.waiter.argument = bytes;
+  return awaiter;
+}
+
+}  // namespace lil
@@ -0,0 +1,104 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/Assert.hpp>
+#include <lil/Err.hpp>
+#include <lil/Result.hpp>
+#include <lil/Str.hpp>
+#include <lil/detail/LilConf.h>
+
+/** @file
+ * Occurrence counters for every Err, so a degrading node can report which codes are spiking without a debugger.
+ *
+ * countErr() is one relaxed, uncontended atomic increment: each core owns a cache line aligned shard of counters chosen
+ * by LIL_TELEMETRY_SHARD(), and shards are only summed when a snapshot is taken. Together with the per-call-site
+ * failure counts kept by LIL_ASSERT, snapshots can be diffed and exported periodically as text or binary.
+ */
+
+namespace lil {
+
+constexpr size_t Telemetry_Shards = LIL_TELEMETRY_SHARDS;
+
+namespace detail {
+struct alignas(64) ErrShard {
+  std::atomic<uint32_t> counts[ERROR_MAX];
+};
+
+extern ErrShard Err_Shards[Telemetry_Shards];
+
+/** @brief Writes "NAME=count" for err into out, which must hold Max_Entry_Chars.
+ * @return The number of characters written.
+ */
+constexpr size_t Max_Entry_Chars = 40;
+size_t           formatErrCount(Err err, uint32_t count, char* out) noexcept;
+}  // namespace detail
+
+/** @brief Counts one occurrence of err and returns it, e.g. `return countErr(BAD_ALLOC);`.
+ * @pre err < ERROR_MAX; other values are folded into range rather than checked.
+ */
+inline Err countErr(Err err) noexcept
+{
+  detail::Err_Shards[LIL_TELEMETRY_SHARD()].counts[err & (ERROR_MAX - 1)].fetch_add(1, std::memory_order_relaxed);
+  return err;
+}
+
+/** @brief Totals of every Err at one point in time. Counts wrap at 2^32, which differences tolerate. */
+class ErrSnapshot {
+public:
+  /** @brief Sums the shards. Increments racing with this may or may not be included. */
+  static ErrSnapshot take() noexcept;
+
+  constexpr uint32_t operator[](Err err) const noexcept { return _counts[err & (ERROR_MAX - 1)]; }
+
+  /** @brief Returns the number of occurrences of any code other than NONE. */
+  uint32_t total() const noexcept;
+
+  /** @brief Returns what was counted between earlier and this snapshot. */
+  ErrSnapshot operator-(const ErrSnapshot& earlier) const noexcept;
+
+private:
+  uint32_t _counts[ERROR_MAX];
+};
+
+/** @brief Appends "NAME=count" for each nonzero code, separated by spaces; application codes are named USER_ERROR+n.
+ * @return Err::RESOURCE_FULL if out filled up, in which case it ends with the last entry that fit.
+ */
+template <uint8_t Size>
+Err format(const ErrSnapshot& snapshot, Str<Size>& out)
+{
+  char entry[detail::Max_Entry_Chars];
+  for (size_t i = 0; i < ERROR_MAX; ++i)
+  {
+    const auto err = static_cast<Err>(i);
+    if (snapshot[err] == 0)
+    {
+      continue;
+    }
+    const size_t separator = (out.size() == 0) ? 0 : 1;
+    const auto   length    = detail::formatErrCount(err, snapshot[err], entry);
+    if ((out.size() + separator + length) > out.max_size())
+    {
+      return RESOURCE_FULL;
+    }
+    out.append(" ", separator).append(entry, length);
+  }
+  return NONE;
+}
+
+/** @brief Writes the nonzero counts of snapshot as little endian [uint16 entries]{[uint16 err][uint32 count]}...
+ * @return The number of bytes written, or Err::RESOURCE_FULL if they would not fit in size.
+ */
+Result<size_t> serialize(const ErrSnapshot& snapshot, void* out, size_t size) noexcept;
+
+/** @brief Writes every LIL_ASSERT site that has failed as little endian [uint16 sites]{[uint32 id][uint32 failures]}...
+ * tools/python/lil_log_decode.py --asserts turns the IDs back into expressions and "file:line".
+ * @return The number of bytes written, or Err::RESOURCE_FULL if they would not fit in size.
+ */
+Result<size_t> serializeAsserts(void* out, size_t size) noexcept;
+
+}  // namespace lil
@@ -0,0 +1,442 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// local
+#include <lil/Interval.hpp>
+
+/** @file
+ * Fork-join parallelism for host builds: batch jobs such as log replay, calibration fitting or hashing over large
+ * arrays. Each worker owns a fixed capacity Chase-Lev deque; join() pushes one half of the work for idle workers to
+ * steal and runs the other half itself, so jobs live on the forking stack and nothing is heap allocated per task.
+ * parallelFor(), parallelReduce() and parallelTransform() split ranges in halves down to an adaptive grain.
+ */
+
+namespace lil {
+namespace detail {
+struct Job {
+  void (*run)(Job& job) noexcept;
+  std::atomic<bool> done{ false };
+};
+
+/** @brief Chase-Lev work stealing deque (Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+ * The owner pushes and pops at the bottom; any thread may steal from the top. The paper's seq_cst fences are folded
+ * into the neighbouring operations, which costs the same on x86 and ARM and keeps ThreadSanitizer able to follow it.
+ */
+template <size_t N>
+class WorkDeque {
+public:
+  static_assert((N > 0) && ((N & (N - 1)) == 0), "WorkDeque capacity must be a power of two");
+
+  /** @brief Owner only. @return false if full. */
+  bool push(Job* job) noexcept
+  {
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top    = _top.load(std::memory_order_acquire);
+    if ((bottom - top) >= static_cast<int64_t>(N))
+    {
+      return false;
+    }
+    _jobs[bottom & Mask].store(job, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** @brief Owner only. @return The most recently pushed job, or nullptr if it was stolen. */
+  Job* pop() noexcept
+  {
+    const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(bottom, std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_seq_cst);
+    if (top > bottom)
+    {
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    auto* job = _jobs[bottom & Mask].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+      if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      {
+        job = nullptr;
+      }
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+  }
+
+  /** @return The oldest job, or nullptr if empty or another thread won the race. */
+  Job* steal() noexcept
+  {
+    auto       top    = _top.load(std::memory_order_seq_cst);
+    const auto bottom = _bottom.load(std::memory_order_seq_cst);
+    if (top >= bottom)
+    {
+      return nullptr;
+    }
+    auto* job = _jobs[top & Mask].load(std::memory_order_relaxed);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+    return job;
+  }
+
+private:
+  static constexpr int64_t Mask = N - 1;
+
+  alignas(64) std::atomic<int64_t> _top{ 0 };
+  alignas(64) std::atomic<int64_t> _bottom{ 0 };
+  std::atomic<Job*> _jobs[N]{};
+};
+}  // namespace detail
+
+/** @brief A fixed set of worker threads that cooperate on fork-join work submitted through run() or the parallel
+ * algorithms. The submitting thread takes part as worker 0; concurrent submitters take turns.
+ */
+class ThreadPool {
+public:
+  /** @brief Nested joins per worker; splitting in halves needs log2(count / grain) of them. */
+  static constexpr size_t Deque_Capacity = 64;
+
+  /** @param threads Total workers including the submitting thread; 1 runs everything inline. */
+  explicit ThreadPool(size_t threads = std::thread::hardware_concurrency())
+      : _size(maximum<size_t>(threads, 1))
+      , _workers(new Worker[_size])
+  {
+    for (size_t i = 1; i < _size; ++i)
+    {
+      _threads.emplace_back([this, i] { work(i); });
+    }
+  }
+
+  ThreadPool(const ThreadPool&)            = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _wake.notify_all();
+    for (auto& thread : _threads)
+    {
+      thread.join();
+    }
+  }
+
+  size_t threads() const noexcept { return _size; }
+
+  /** @brief Runs task with this pool's workers available to join(); returns once all work it forked is done. */
+  template <typename Task>
+  void run(Task&& task)
+  {
+    if (Current_Pool == this)
+    {
+      task();
+      return;
+    }
+    std::lock_guard<std::mutex> submitting(_submit);
+    enter(0);
+    task();
+    leave();
+  }
+
+  /** @brief Runs left and right, possibly in parallel, and returns when both have finished. */
+  template <typename Left, typename Right>
+  void join(Left&& left, Right&& right)
+  {
+    if (Current_Pool != this)
+    {
+      run([&] { join(left, right); });
+      return;
+    }
+    struct RightJob : detail::Job {
+      std::remove_reference_t<Right>* right;
+    } job;
+    job.right = &right;
+    job.run   = [](detail::Job& self) noexcept { (*static_cast<RightJob&>(self).right)(); };
+
+    auto& deque = _workers[Current_Index].deque;
+    if ((_size == 1) || !deque.push(&job))
+    {
+      left();
+      right();
+      return;
+    }
+    left();
+    if (deque.pop() == &job)
+    {
+      right();
+      return;
+    }
+    // Stolen: help with other work rather than block until the thief finishes
+    while (!job.done.load(std::memory_order_acquire))
+    {
+      if (!tryRunOne(Current_Index))
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  struct alignas(64) Worker {
+    detail::WorkDeque<Deque_Capacity> deque;
+  };
+
+  size_t                    _size;
+  std::unique_ptr<Worker[]> _workers;
+  std::vector<std::thread>  _threads;
+  std::mutex                _submit;  ///< Held by the thread acting as worker 0.
+  std::mutex                _mutex;
+  std::condition_variable   _wake;
+  bool                      _busy = false;  ///< Work has been submitted; guarded by _mutex.
+  bool                      _stop = false;  ///< Guarded by _mutex.
+  std::atomic<bool>         _active{ false };
+
+  static inline thread_local ThreadPool* Current_Pool  = nullptr;
+  static inline thread_local size_t      Current_Index = 0;
+
+  void enter(size_t index) noexcept
+  {
+    Current_Pool  = this;
+    Current_Index = index;
+    if (_size > 1)
+    {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _busy = true;
+      }
+      _active.store(true, std::memory_order_release);
+      _wake.notify_all();
+    }
+  }
+
+  void leave() noexcept
+  {
+    if (_size > 1)
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _busy = false;
+      _active.store(false, std::memory_order_relaxed);
+    }
+    Current_Pool = nullptr;
+  }
+
+  bool tryRunOne(size_t self) noexcept
+  {
+    // Start from a different victim each time so thieves spread out
+    thread_local uint32_t seed = static_cast<uint32_t>(self * 2654435761U) | 1;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    for (size_t i = 0; i < _size; ++i)
+    {
+      const auto victim = (seed + i) % _size;
+      if (victim == self)
+      {
+        continue;
+      }
+      if (auto* job = _workers[victim].deque.steal())
+      {
+        job->run(*job);
+        job->done.store(true, std::memory_order_release);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void work(size_t index) noexcept
+  {
+    Current_Pool  = this;
+    Current_Index = index;
+    for (;;)
+    {
+      if (!_active.load(std::memory_order_acquire))
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _wake.wait(lock, [this] { return _busy || _stop; });
+        if (_stop)
+        {
+          return;
+        }
+        continue;
+      }
+      if (!tryRunOne(index))
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+};
+
+namespace detail {
+/** @brief Splits work finely enough for every worker to steal several pieces, but not below minGrain. */
+inline size_t adaptiveGrain(const ThreadPool& pool, size_t count, size_t minGrain) noexcept
+{
+  constexpr size_t Pieces_Per_Thread = 8;
+  return maximum(maximum<size_t>(minGrain, 1), count / (pool.threads() * Pieces_Per_Thread));
+}
+
+template <typename Chunk>
+void forChunks(ThreadPool& pool, size_t begin, size_t end, size_t grain, Chunk& chunk)
+{
+  if ((end - begin) <= grain)
+  {
+    chunk(begin, end);
+    return;
+  }
+  const auto middle = begin + ((end - begin) / 2);
+  pool.join([&] { forChunks(pool, begin, middle, grain, chunk); }, [&] { forChunks(pool, middle, end, grain, chunk); });
+}
+
+template <typename T, typename Chunk, typename Combine>
+T reduceChunks(ThreadPool& pool, size_t begin, size_t end, size_t grain, Chunk& chunk, Combine& combine)
+{
+  if ((end - begin) <= grain)
+  {
+    return chunk(begin, end);
+  }
+  const auto middle = begin + ((end - begin) / 2);
+  T          left;
+  T          right;
+  pool.join([&] { left = reduceChunks<T>(pool, begin, middle, grain, chunk, combine); },
+            [&] { right = reduceChunks<T>(pool, middle, end, grain, chunk, combine); });
+  return combine(left, right);
+}
+}  // namespace detail
+
+/** @brief Calls chunk(begin, end) over disjoint chunks covering [0, count), in parallel. Suits batch kernels that take
+ * a pointer and a count.
+ * @param minGrain Smallest chunk worth the cost of a steal; 0 lets the pool choose.
+ */
+template <typename Chunk>
+void parallelFor(ThreadPool& pool, size_t count, Chunk chunk, size_t minGrain = 0)
+{
+  const auto grain = detail::adaptiveGrain(pool, count, minGrain);
+  pool.run([&] { detail::forChunks(pool, 0, count, grain, chunk); });
+}
+
+/** @brief Calls function(element) for every element of data[0, size), in parallel. */
+template <typename T, typename Function>
+void parallelFor(ThreadPool& pool, T* data, size_t size, Function function)
+{
+  parallelFor(pool, size, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      function(data[i]);
+    }
+  });
+}
+
+/** @brief Calls function(element) for every element of an IArr or any other range with data() and size(). */
+template <typename Range, typename Function>
+  requires requires(Range& range) {
+    range.data();
+    range.size();
+  }
+void parallelFor(ThreadPool& pool, Range& range, Function function)
+{
+  parallelFor(pool, range.data(), range.size(), function);
+}
+
+/** @brief Reduces [0, count) by calling chunk(begin, end) -> T on disjoint chunks and merging their results with
+ * combine(T, T) -> T. The merge tree depends only on count and the grain, not on scheduling.
+ */
+template <typename T, typename Chunk, typename Combine>
+T parallelReduce(ThreadPool& pool, size_t count, T identity, Chunk chunk, Combine combine, size_t minGrain = 0)
+{
+  if (count == 0)
+  {
+    return identity;
+  }
+  const auto grain  = detail::adaptiveGrain(pool, count, minGrain);
+  T          result = identity;
+  pool.run([&] { result = detail::reduceChunks<T>(pool, 0, count, grain, chunk, combine); });
+  return result;
+}
+
+/** @brief Folds every element of data[0, size) into identity with combine(T, element) -> T, and merges the results of
+ * chunks with merge(T, T) -> T; both must be associative. E.g. to sum uint8_t samples into a uint64_t, combine adds a
+ * sample to a total and merge adds two totals.
+ */
+template <typename T, typename U, typename Combine, typename Merge>
+T parallelReduce(ThreadPool& pool, const U* data, size_t size, T identity, Combine combine, Merge merge)
+{
+  return parallelReduce(
+    pool, size, identity,
+    [&](size_t begin, size_t end) {
+      T accumulator = identity;
+      for (size_t i = begin; i < end; ++i)
+      {
+        accumulator = combine(accumulator, data[i]);
+      }
+      return accumulator;
+    },
+    merge);
+}
+
+/** @brief Folds every element of data[0, size) into identity with combine(T, T) -> T, which must be associative and
+ * also merges the results of chunks. Elements of another type need a separate merge, see above.
+ */
+template <typename T, typename Combine>
+T parallelReduce(ThreadPool& pool, const T* data, size_t size, T identity, Combine combine)
+{
+  return parallelReduce(pool, data, size, identity, combine, combine);
+}
+
+template <typename T, typename Range, typename Combine, typename Merge>
+  requires requires(const Range& range) {
+    range.data();
+    range.size();
+  }
+T parallelReduce(ThreadPool& pool, const Range& range, T identity, Combine combine, Merge merge)
+{
+  return parallelReduce(pool, range.data(), range.size(), identity, combine, merge);
+}
+
+template <typename T, typename Range, typename Combine>
+  requires requires(const Range& range) {
+    range.data();
+    range.size();
+  }
+T parallelReduce(ThreadPool& pool, const Range& range, T identity, Combine combine)
+{
+  return parallelReduce(pool, range.data(), range.size(), identity, combine);
+}
+
+/** @brief Writes out[i] = function(in[i]) for i in [0, size), in parallel; out may alias in. */
+template <typename In, typename Out, typename Function>
+void parallelTransform(ThreadPool& pool, const In* in, size_t size, Out* out, Function function)
+{
+  parallelFor(pool, size, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      out[i] = function(in[i]);
+    }
+  });
+}
+
+template <typename Range, typename Out, typename Function>
+  requires requires(const Range& range) {
+    range.data();
+    range.size();
+  }
+void parallelTransform(ThreadPool& pool, const Range& range, Out* out, Function function)
+{
+  parallelTransform(pool, range.data(), range.size(), out, function);
+}
+
+}  // namespace lil
@@ -0,0 +1,327 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/Binary.hpp>
+#include <lil/Err.hpp>
+#include <lil/Result.hpp>
+
+namespace lil {
+
+/** @brief Identifies a scheduled timer; stays unique after the timer expires or is cancelled. */
+struct TimerId {
+  uint32_t index;
+  uint32_t generation;
+
+  constexpr bool operator==(const TimerId& other) const noexcept
+  {
+    return (index == other.index) && (generation == other.generation);
+  }
+};
+
+/** @brief Fixed capacity hierarchical timing wheel: O(1) schedule, cancel and reschedule for any number of timers.
+ *
+ * Level L has 64 slots of 64^L ticks each; a timer sits in the lowest level whose span covers its delay and cascades
+ * down a level each time the level below wraps, so it is touched at most Levels times before it fires. Each level keeps
+ * a 64 bit occupancy mask, which lets advance() jump straight to the next occupied slot instead of visiting every tick.
+ * Delays beyond 64^Levels ticks park in the top level and re-cascade until due.
+ *
+ * Ticks are any free-running uint32_t clock, e.g. milliseconds of a host steady clock or FreeRTOS xTaskGetTickCount();
+ * call advance() with the current count from a periodic task or tick hook. Not thread-safe.
+ * @tparam Capacity Maximum number of pending timers; their storage is allocated inline.
+ * @tparam Levels Number of wheels; 4 covers 2^24 ticks without re-cascading.
+ */
+template <size_t Capacity, size_t Levels = 4>
+class TimingWheel {
+public:
+  static_assert((Capacity > 0) && (Capacity < UINT32_MAX), "TimingWheel capacity must fit a 32 bit index");
+  static_assert((Levels > 0) && (Levels <= 5), "TimingWheel levels must span at most 2^30 ticks");
+
+  using Callback = void (*)(void* context, TimerId timer);
+
+  static constexpr uint32_t Slot_Bits = 6;
+  static constexpr uint32_t Slots     = 1U << Slot_Bits;
+  static constexpr uint32_t Max_Delay = INT32_MAX;  ///< Longest delay; deadlines are compared modulo 2^32.
+
+  explicit TimingWheel(uint32_t now = 0) noexcept
+      : _now(now)
+  {
+    for (auto& head : _heads)
+    {
+      head = Null;
+    }
+    for (uint32_t i = 0; i < Capacity; ++i)
+    {
+      _nodes[i].next       = i + 1;
+      _nodes[i].slot       = Free;
+      _nodes[i].generation = 0;
+    }
+    _nodes[Capacity - 1].next = Null;
+  }
+
+  TimingWheel(const TimingWheel&)            = delete;
+  TimingWheel& operator=(const TimingWheel&) = delete;
+
+  /** @brief Calls callback(context, id) from the advance() that reaches now() + delay.
+   * @return The timer's ID, or Err::RESOURCE_FULL if Capacity timers are pending.
+   * @pre delay <= Max_Delay
+   */
+  Result<TimerId> schedule(uint32_t delay, Callback callback, void* context) noexcept
+  {
+    if (_free == Null)
+    {
+      return RESOURCE_FULL;
+    }
+    const auto index = _free;
+    auto&      node  = _nodes[index];
+    _free            = node.next;
+    node.callback    = callback;
+    node.context     = context;
+    node.deadline    = _now + delay;
+    place(index);
+    ++_size;
+    return TimerId{ index, node.generation };
+  }
+
+  /** @brief Stops timer from firing.
+   * @return Err::INVALID_ARGUMENT if timer already fired or was cancelled.
+   */
+  Err cancel(TimerId timer) noexcept
+  {
+    if (!pending(timer))
+    {
+      return INVALID_ARGUMENT;
+    }
+    unlink(timer.index);
+    release(timer.index);
+    return NONE;
+  }
+
+  /** @brief Moves a pending timer's deadline to now() + delay, keeping its ID.
+   * @return Err::INVALID_ARGUMENT if timer already fired or was cancelled.
+   */
+  Err reschedule(TimerId timer, uint32_t delay) noexcept
+  {
+    if (!pending(timer))
+    {
+      return INVALID_ARGUMENT;
+    }
+    unlink(timer.index);
+    _nodes[timer.index].deadline = _now + delay;
+    place(timer.index);
+    return NONE;
+  }
+
+  /** @brief Returns whether timer is scheduled and has not fired. */
+  bool pending(TimerId timer) const noexcept
+  {
+    return (timer.index < Capacity) && (_nodes[timer.index].slot != Free) &&
+           (_nodes[timer.index].generation == timer.generation);
+  }
+
+  /** @brief Fires every timer due by now, tick by tick; callbacks may schedule and cancel timers.
+   * @return The number of timers fired.
+   */
+  size_t advance(uint32_t now) noexcept
+  {
+    size_t fired = fireDue();
+    while (static_cast<int32_t>(now - _now) > 0)
+    {
+      const auto next = nextEvent();
+      if (static_cast<int32_t>(next - now) > 0)
+      {
+        _now = now;
+        break;
+      }
+      _now = next;
+      cascade();
+      fired += fireDue();
+    }
+    return fired;
+  }
+
+  /** @brief Returns how many ticks may pass before advance() has work to do, e.g. to sleep a tickless idle task.
+   * May be early, when a timer merely needs cascading; Max_Delay if nothing is pending.
+   */
+  uint32_t idleTicks() const noexcept
+  {
+    if (_heads[Due] != Null)
+    {
+      return 0;
+    }
+    return (_size == 0) ? Max_Delay : (nextEvent() - _now);
+  }
+
+  uint32_t         now() const noexcept { return _now; }
+  size_t           size() const noexcept { return _size; }
+  constexpr size_t capacity() const noexcept { return Capacity; }
+
+private:
+  static constexpr uint32_t Null = UINT32_MAX;
+  static constexpr uint16_t Due  = Levels * Slots;  ///< List of timers to fire before the wheel turns again.
+  static constexpr uint16_t Free = Due + 1;
+  static constexpr uint32_t Mask = Slots - 1;
+
+  struct Node {
+    uint32_t deadline;
+    uint32_t prev;
+    uint32_t next;
+    uint32_t generation;
+    uint16_t slot;
+    Callback callback;
+    void*    context;
+  };
+
+  Node     _nodes[Capacity];
+  uint32_t _heads[(Levels * Slots) + 1];
+  uint64_t _occupied[Levels]{};
+  uint32_t _now;
+  uint32_t _free = 0;
+  size_t   _size = 0;
+
+  static constexpr uint32_t shift(uint32_t level) noexcept { return level * Slot_Bits; }
+
+  void place(uint32_t index) noexcept
+  {
+    const auto delay = _nodes[index].deadline - _now;
+    if ((delay == 0) || (delay > Max_Delay))
+    {
+      link(index, Due);
+      return;
+    }
+    uint32_t level = 0;
+    while ((level < (Levels - 1)) && (delay >= (1U << shift(level + 1))))
+    {
+      ++level;
+    }
+    // Beyond the top level's span: park in its farthest slot and re-cascade from there
+    const auto span   = 1ULL << shift(Levels);
+    const auto target = (delay < span) ? _nodes[index].deadline : static_cast<uint32_t>(_now + span - 1);
+    const auto slot   = (target >> shift(level)) & Mask;
+    link(index, static_cast<uint16_t>((level * Slots) + slot));
+  }
+
+  void link(uint32_t index, uint16_t slot) noexcept
+  {
+    auto& node = _nodes[index];
+    node.slot  = slot;
+    node.prev  = Null;
+    node.next  = _heads[slot];
+    if (node.next != Null)
+    {
+      _nodes[node.next].prev = index;
+    }
+    _heads[slot] = index;
+    if (slot < Due)
+    {
+      _occupied[slot / Slots] |= 1ULL << (slot % Slots);
+    }
+  }
+
+  void unlink(uint32_t index) noexcept
+  {
+    auto& node = _nodes[index];
+    if (node.prev != Null)
+    {
+      _nodes[node.prev].next = node.next;
+    }
+    else
+    {
+      _heads[node.slot] = node.next;
+    }
+    if (node.next != Null)
+    {
+      _nodes[node.next].prev = node.prev;
+    }
+    if ((node.slot < Due) && (_heads[node.slot] == Null))
+    {
+      _occupied[node.slot / Slots] &= ~(1ULL << (node.slot % Slots));
+    }
+  }
+
+  void release(uint32_t index) noexcept
+  {
+    auto& node = _nodes[index];
+    node.slot  = Free;
+    ++node.generation;
+    node.next = _free;
+    _free     = index;
+    --_size;
+  }
+
+  /** @brief Returns the first tick after now() at which a level has an occupied slot to fire or cascade. */
+  uint32_t nextEvent() const noexcept
+  {
+    uint32_t next = _now + Max_Delay;
+    for (uint32_t level = 0; level < Levels; ++level)
+    {
+      const auto occupied = _occupied[level];
+      if (occupied == 0)
+      {
+        continue;
+      }
+      // Rotate so bit 0 is the slot after the current one; the current slot itself comes round last
+      const auto current = (_now >> shift(level)) & Mask;
+      const auto start   = (current + 1) & Mask;
+      const auto rotated = (occupied >> start) | ((start == 0) ? 0 : (occupied << (Slots - start)));
+      const auto steps   = static_cast<uint32_t>(ctz(rotated)) + 1;
+      const auto tick    = (((_now >> shift(level)) + steps) << shift(level));
+      if (static_cast<int32_t>(tick - next) < 0)
+      {
+        next = tick;
+      }
+    }
+    return next;
+  }
+
+  /** @brief At now(), moves the slot each wrapping level points at down the hierarchy, and level 0's slot to Due. */
+  void cascade() noexcept
+  {
+    uint32_t top = 0;
+    while (((top + 1) < Levels) && ((_now & ((1U << shift(top + 1)) - 1)) == 0))
+    {
+      ++top;
+    }
+    for (uint32_t level = top + 1; level-- > 0;)
+    {
+      const auto slot = static_cast<uint16_t>((level * Slots) + ((_now >> shift(level)) & Mask));
+      auto       index = _heads[slot];
+      _heads[slot]     = Null;
+      _occupied[level] &= ~(1ULL << (slot % Slots));
+      while (index != Null)
+      {
+        const auto next = _nodes[index].next;
+        place(index);
+        index = next;
+      }
+    }
+  }
+
+  size_t fireDue() noexcept
+  {
+    size_t fired = 0;
+    while (_heads[Due] != Null)
+    {
+      const auto index = _heads[Due];
+      auto&      node  = _nodes[index];
+      unlink(index);
+      if (static_cast<int32_t>(node.deadline - _now) > 0)
+      {
+        place(index);
+        continue;
+      }
+      const TimerId timer{ index, node.generation };
+      const auto    callback = node.callback;
+      const auto    context  = node.context;
+      release(index);
+      callback(context, timer);
+      ++fired;
+    }
+    return fired;
+  }
+};
+
+}  // namespace lil
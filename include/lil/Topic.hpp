@@ -0,0 +1,216 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+// local
+#include <lil/Err.hpp>
+#include <lil/Result.hpp>
+#include <lil/Str.hpp>
+
+/** @file
+ * Zero-copy publish/subscribe between modules, without a heap or a callback registry.
+ *
+ * A Topic owns a static pool of message slots. The publisher loans a slot, fills it in place and publishes it; every
+ * subscriber then receives a pointer to that same slot, which stays valid until it calls release(). Slots are reference
+ * counted and fan-out is one lock-free index push per subscriber, so a message is never copied after it is written.
+ * A publisher that outruns its subscribers gets an error rather than blocking:
+ * - Err::RESOURCE_BUSY from loan() when every slot is still held by a subscriber;
+ * - Err::RESOURCE_FULL from publish() when a subscriber's queue has no room, in which case no subscriber receives it.
+ * @code
+ * Topic<ImuSample, 8, 4> imuTopic{ str_literal("imu/raw") };
+ *
+ * // Producer
+ * if (auto sample = imuTopic.loan(); sample) { readImu(*sample); imuTopic.publish(sample.value()); }
+ *
+ * // Each consumer, after `auto imu = *imuTopic.subscribe();` during initialization
+ * while (auto sample = imu.receive()) { integrate(*sample); imu.release(sample.value()); }
+ * @endcode
+ */
+
+namespace lil {
+
+constexpr uint8_t Topic_Name_Size = 32;  ///< Capacity of a Topic name, including the null terminator.
+
+/** @brief A named channel delivering TMessage from one publisher to up to Subscribers receivers.
+ *
+ * Exactly one context may loan() and publish(); each Subscriber may be used from one context of its own. Subscribers
+ * are expected to be wired up during initialization and last for the life of the Topic.
+ * @tparam TMessage A trivially copyable message type; its slots are allocated inline.
+ * @tparam Slots Number of messages that may be in flight at once.
+ * @tparam Subscribers Maximum number of subscribers.
+ * @tparam Depth Capacity of each subscriber's queue; must be a power of two. Queues cannot fill when Depth >= Slots.
+ */
+template <typename TMessage, size_t Slots, size_t Subscribers, size_t Depth = Slots>
+class Topic {
+public:
+  static_assert(std::is_trivially_copyable<TMessage>::value, "Topic messages must be trivially copyable");
+  static_assert((Slots > 0) && (Slots <= UINT16_MAX), "Topic slots must fit a 16 bit index");
+  static_assert(Subscribers > 0, "Topic must allow at least one subscriber");
+  static_assert((Depth > 0) && ((Depth & (Depth - 1)) == 0), "Topic queue depth must be a power of two");
+
+  /** @brief A receiving end of a Topic; cheap to copy, but only one context may use a given subscriber. */
+  class Subscriber {
+  public:
+    /** @return The oldest message not yet received, or Err::RESOURCE_EMPTY. Pass it to release() once read. */
+    Result<const TMessage*> receive() const noexcept { return _topic->receive(_index); }
+
+    /** @brief Returns a received message's slot to the Topic once every subscriber has released it. */
+    void release(const TMessage* message) const noexcept { _topic->release(message); }
+
+    /** @brief Returns the number of messages waiting to be received. */
+    size_t pending() const noexcept { return _topic->pending(_index); }
+
+  private:
+    friend class Topic;
+
+    Subscriber(Topic* topic, uint32_t index) noexcept
+        : _topic(topic)
+        , _index(index)
+    {
+    }
+
+    Topic*   _topic;
+    uint32_t _index;
+  };
+
+  template <uint8_t NameSize>
+  explicit Topic(const Str<NameSize>& name) noexcept
+      : _name(name)
+  {
+    static_assert(NameSize <= Topic_Name_Size, "Topic name is too long");
+  }
+
+  Topic(const Topic&)            = delete;
+  Topic& operator=(const Topic&) = delete;
+
+  /** @brief Adds a subscriber, which receives every message published from now on. Lock-free.
+   * @return Err::RESOURCE_FULL if Subscribers have already subscribed.
+   */
+  Result<Subscriber> subscribe() noexcept
+  {
+    auto count = _subscribers.load(std::memory_order_relaxed);
+    do
+    {
+      if (count == Subscribers)
+      {
+        return RESOURCE_FULL;
+      }
+    } while (!_subscribers.compare_exchange_weak(count, count + 1, std::memory_order_release,
+                                                 std::memory_order_relaxed));
+    return Subscriber(this, count);
+  }
+
+  /** @brief Publisher: takes a free slot to write the next message into, which must then be passed to publish().
+   * @return Err::RESOURCE_BUSY if subscribers still hold every slot.
+   */
+  Result<TMessage*> loan() noexcept
+  {
+    // Slots are released roughly in publication order, so the one after the last loan is almost always free
+    for (size_t i = 0; i < Slots; ++i)
+    {
+      const auto slot = _next;
+      _next           = (_next + 1 == Slots) ? 0 : (_next + 1);
+      if (_refs[slot].load(std::memory_order_acquire) == 0)
+      {
+        _refs[slot].store(1, std::memory_order_relaxed);
+        return &_messages[slot];
+      }
+    }
+    return RESOURCE_BUSY;
+  }
+
+  /** @brief Publisher: delivers a loaned message to every subscriber, or to none of them. The loan ends either way.
+   * @return Err::RESOURCE_FULL if a subscriber's queue is full.
+   */
+  Err publish(TMessage* message) noexcept
+  {
+    const auto slot  = static_cast<uint16_t>(message - _messages);
+    const auto count = _subscribers.load(std::memory_order_acquire);
+    // Only the publisher adds to queues, so room found here cannot disappear before the pushes below
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      const auto& queue = _queues[i];
+      if ((queue.head.load(std::memory_order_relaxed) - queue.tail.load(std::memory_order_acquire)) == Depth)
+      {
+        _refs[slot].store(0, std::memory_order_relaxed);
+        return RESOURCE_FULL;
+      }
+    }
+    _refs[slot].store(count, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      auto&      queue         = _queues[i];
+      const auto head          = queue.head.load(std::memory_order_relaxed);
+      queue.slots[head & Mask] = slot;
+      queue.head.store(head + 1, std::memory_order_release);
+    }
+    return NONE;
+  }
+
+  /** @brief Publisher: copies message into a slot and publishes it.
+   * @return Err::RESOURCE_BUSY if no slot is free, Err::RESOURCE_FULL if a subscriber's queue is full.
+   */
+  Err publish(const TMessage& message) noexcept
+  {
+    auto slot = loan();
+    if (!slot)
+    {
+      return slot.err();
+    }
+    *slot = message;
+    return publish(slot.value());
+  }
+
+  const Str<Topic_Name_Size>& name() const noexcept { return _name; }
+  size_t subscribers() const noexcept { return _subscribers.load(std::memory_order_acquire); }
+  constexpr size_t capacity() const noexcept { return Slots; }
+
+private:
+  static constexpr uint32_t Mask = Depth - 1;
+
+  /** @brief A single producer, single consumer ring of slot indices; the counters sit on their own cache lines so
+   * subscribers draining their queues do not slow the publisher or each other.
+   */
+  struct Queue {
+    alignas(64) std::atomic<uint32_t> head{ 0 };  ///< Total messages ever pushed; owned by the publisher.
+    uint16_t                          slots[Depth];
+    alignas(64) std::atomic<uint32_t> tail{ 0 };  ///< Total messages ever received; owned by the subscriber.
+  };
+
+  Str<Topic_Name_Size>  _name;
+  TMessage              _messages[Slots]{};
+  std::atomic<uint32_t> _refs[Slots]{};  ///< Subscribers yet to release each slot; 0 when free.
+  std::atomic<uint32_t> _subscribers{ 0 };
+  size_t                _next = 0;  ///< Where the publisher's next search for a free slot starts.
+  Queue                 _queues[Subscribers];
+
+  Result<const TMessage*> receive(uint32_t index) noexcept
+  {
+    auto&      queue = _queues[index];
+    const auto tail  = queue.tail.load(std::memory_order_relaxed);
+    if (queue.head.load(std::memory_order_acquire) == tail)
+    {
+      return RESOURCE_EMPTY;
+    }
+    const auto slot = queue.slots[tail & Mask];
+    queue.tail.store(tail + 1, std::memory_order_release);
+    return &_messages[slot];
+  }
+
+  void release(const TMessage* message) noexcept
+  {
+    _refs[message - _messages].fetch_sub(1, std::memory_order_release);
+  }
+
+  size_t pending(uint32_t index) const noexcept
+  {
+    const auto& queue = _queues[index];
+    return queue.head.load(std::memory_order_acquire) - queue.tail.load(std::memory_order_relaxed);
+  }
+};
+
+}  // namespace lil
@@ -0,0 +1,157 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/Result.hpp>
+#include <lil/detail/LilConf.h>
+#include <lil/detail/Macro.hpp>
+
+#ifndef LIL_TRACE_CLOCK
+#  if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define LIL_TRACE_CLOCK() __rdtsc()
+#  elif defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#    define LIL_TRACE_CLOCK() __rdtsc()
+#  else
+#    define LIL_TRACE_CLOCK() ::lil::detail::traceClock()
+#  endif
+#endif
+
+/** @file
+ * Scoped timing zones, recorded per thread and exported as a Chrome trace, to see where the time went around a spike.
+ *
+ * LIL_TRACE_ZONE("name") notes the clock when it is declared and, when its scope ends, appends the zone's name and
+ * its begin and end ticks to the calling thread's buffer: two clock reads and a store into a single producer ring, with
+ * no locks and no shared cache lines. A zone's ID is the address of its name, so names must be string literals.
+ * traceFlush() drains every thread's buffer as Chrome trace event JSON, which chrome://tracing and ui.perfetto.dev
+ * open directly.
+ *
+ * The clock is LIL_TRACE_CLOCK(): the time stamp counter on x86, CLOCK_MONOTONIC elsewhere, or e.g. the DWT cycle
+ * counter when defined in LilConf.h together with LIL_TRACE_TICKS_PER_US. LIL_TRACE_ZONE compiles to nothing unless
+ * LIL_TRACE_ENABLED is true, which may be set for the whole build or just in the files being investigated.
+ * @code
+ * void Controller::step()
+ * {
+ *   LIL_TRACE_ZONE("Controller::step");
+ *   ...
+ * }
+ *
+ * // Periodically, from one thread
+ * char json[4096];
+ * while (auto written = lil::traceFlush(json, sizeof(json)); written && (*written > 0))
+ * {
+ *   fwrite(json, 1, *written, file);
+ * }
+ * @endcode
+ */
+
+namespace lil {
+
+constexpr size_t Trace_Event_Chars = 320;  ///< Room traceFlush() needs for an event, however long its zone's name.
+
+/** @brief Appends the zones recorded since the last call as Chrome trace events, and removes them from the buffers.
+ *
+ * The output is the JSON array format, which may be left unterminated: the first call writes "[", then each zone is
+ * written as one complete event followed by ",\n". The output of successive calls concatenated is a trace file. Only
+ * one thread may flush at a time.
+ * @return The number of bytes written, 0 once nothing is pending, or Err::RESOURCE_FULL if size is less than
+ * Trace_Event_Chars and an event is pending.
+ */
+Result<size_t> traceFlush(char* out, size_t size) noexcept;
+
+/** @brief Returns how many zones have been lost because a thread's buffer was full or every buffer was in use. */
+uint32_t traceDropped() noexcept;
+
+namespace detail {
+constexpr uint32_t Trace_Events = LIL_TRACE_EVENTS;
+
+static_assert((Trace_Events > 0) && ((Trace_Events & (Trace_Events - 1)) == 0),
+              "LIL_TRACE_EVENTS must be a power of two");
+
+struct TraceEvent {
+  const char* name;
+  uint64_t    begin;
+  uint64_t    end;
+};
+
+/** @brief One thread's ring of zones; the thread that claims it is the producer and traceFlush() the consumer. */
+struct TraceBuffer {
+  alignas(64) std::atomic<uint32_t> head{ 0 };  ///< Total zones ever recorded; owned by the producer.
+  uint32_t                          tailSeen = 0;  ///< The producer's last view of tail, refreshed only when full.
+  TraceEvent                        events[Trace_Events];
+  alignas(64) std::atomic<uint32_t> tail{ 0 };  ///< Total zones ever flushed; owned by the consumer.
+  std::atomic<bool>                 claimed{ false };
+};
+
+/** @brief The calling thread's buffer, or nullptr until its first zone ends. */
+inline thread_local TraceBuffer* Trace_Buffer = nullptr;
+
+/** @brief Returns CLOCK_MONOTONIC in nanoseconds; the default LIL_TRACE_CLOCK() without a time stamp counter. */
+uint64_t traceClock() noexcept;
+
+/** @brief Claims a free buffer for the calling thread until it exits; nullptr, counting a drop, if none is free. */
+TraceBuffer* traceClaim() noexcept;
+
+/** @brief Counts a zone that could not be recorded. */
+void traceDrop() noexcept;
+
+inline void traceRecord(const char* name, uint64_t begin, uint64_t end) noexcept
+{
+  auto* buffer = Trace_Buffer;
+  if (buffer == nullptr)
+  {
+    buffer = traceClaim();
+    if (buffer == nullptr)
+    {
+      return;
+    }
+  }
+  const auto head = buffer->head.load(std::memory_order_relaxed);
+  if ((head - buffer->tailSeen) == Trace_Events)
+  {
+    buffer->tailSeen = buffer->tail.load(std::memory_order_acquire);
+    if ((head - buffer->tailSeen) == Trace_Events)
+    {
+      traceDrop();
+      return;
+    }
+  }
+  buffer->events[head & (Trace_Events - 1)] = { name, begin, end };
+  buffer->head.store(head + 1, std::memory_order_release);
+}
+
+/** @brief Records the time between its construction and destruction; declared by LIL_TRACE_ZONE. */
+class TraceZone {
+public:
+  explicit TraceZone(const char* name) noexcept
+      : _name(name)
+      , _begin(LIL_TRACE_CLOCK())
+  {
+  }
+
+  ~TraceZone() { traceRecord(_name, _begin, LIL_TRACE_CLOCK()); }
+
+  TraceZone(const TraceZone&)            = delete;
+  TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+  const char* _name;
+  uint64_t    _begin;
+};
+}  // namespace detail
+}  // namespace lil
+
+#if LIL_TRACE_ENABLED
+/** @brief Times the rest of the enclosing scope as a zone called name, a string literal. @see Trace.hpp */
+#  define LIL_TRACE_ZONE(name) const ::lil::detail::TraceZone LIL_CONCAT(lil_trace_zone_, __LINE__)(name "")
+#else
+#  define LIL_TRACE_ZONE(name)                                                                                          \
+    do                                                                                                                  \
+    {                                                                                                                   \
+    } while (false)
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+// std
+#include <stddef.h>
+#include <stdint.h>
+
+// local
+#include <lil/Cpu.hpp>
+
+namespace lil {
+
+namespace detail {
+using Utf8ValidFunction = bool (*)(const char* data, size_t size) noexcept;
+
+extern const Kernel<Utf8ValidFunction> Utf8_Valid_Kernel;
+}  // namespace detail
+
+/** @brief Checks that size bytes are well-formed UTF-8 per RFC 3629: no overlong encodings, surrogates, code points
+ * above U+10FFFF, or truncated sequences. Runs of ASCII are skipped a vector at a time where the CPU allows.
+ */
+bool utf8Valid(const char* data, size_t size) noexcept;
+
+}  // namespace lil
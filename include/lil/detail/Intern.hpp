@@ -0,0 +1,29 @@
+#pragma once
+
+// local
+#include <lil/detail/Macro.hpp>
+
+/** @file
+ * Interns text in the ELF rather than in flash, for LIL_LOG and LIL_ASSERT. An entry is LIL_LOG_MAGIC, "file:line",
+ * NUL, then the text, placed by LIL_LOG_SECTION in a lil_log.* section; the device only ever handles the FNV-1a hash of
+ * the entry, and tools/python/lil_log_decode.py maps hashes back to entries. @see Log.hpp
+ */
+
+/** @brief Prefix that marks an entry, so the decoder can find entries wherever the toolchain placed them. */
+#define LIL_LOG_MAGIC "\x1f" "LIL" "\x1f"
+
+#if defined(__has_attribute)
+#  if __has_attribute(retain)
+#    define LIL_LOG_RETAIN retain,
+#  endif
+#endif
+#ifndef LIL_LOG_RETAIN
+#  define LIL_LOG_RETAIN
+#endif
+
+/** @brief Places an entry in a section of its own; a shared section would conflict between inline and non-inline
+ * functions. GCC ignores section attributes inside templates, in which case the entry lands in .rodata and the decoder
+ * finds it by LIL_LOG_MAGIC instead.
+ */
+#define LIL_LOG_SECTION \
+  __attribute__((section("lil_log." LIL_STRINGIFY(__LINE__) "." LIL_STRINGIFY(__COUNTER__)), LIL_LOG_RETAIN used))
@@ -9,4 +9,77 @@
 #define LIL_USE_IOSTREAM false
 #endif  /* LIL_USE_IOSTREAM */
 
+#ifndef LIL_LOG_ENABLED
+#if defined(__ELF__) && defined(__GNUC__)
+#define LIL_LOG_ENABLED true
+#else
+#define LIL_LOG_ENABLED false
+#endif
+#endif  /* LIL_LOG_ENABLED */
+
+#ifndef LIL_LOG_BUFFER_SIZE
+#define LIL_LOG_BUFFER_SIZE 1024
+#endif  /* LIL_LOG_BUFFER_SIZE */
+
+#ifndef LIL_TELEMETRY_SHARDS
+#define LIL_TELEMETRY_SHARDS 1
+#endif  /* LIL_TELEMETRY_SHARDS */
+
+#ifndef LIL_TELEMETRY_SHARD
+/* Expression giving the calling core's index in [0, LIL_TELEMETRY_SHARDS), e.g. a read of the core ID register. */
+#define LIL_TELEMETRY_SHARD() 0
+#endif  /* LIL_TELEMETRY_SHARD */
+
+#ifndef LIL_TASK_FRAME_BYTES
+#define LIL_TASK_FRAME_BYTES 512
+#endif  /* LIL_TASK_FRAME_BYTES */
+
+#ifndef LIL_TASK_FRAMES
+#define LIL_TASK_FRAMES 8
+#endif  /* LIL_TASK_FRAMES */
+
+#ifndef LIL_TASK_IDLE
+/* Statement Executor::run() runs while no task is ready, given the clock ticks until the next deadline (0 while polling,
+   UINT32_MAX if none), e.g. vTaskDelay(ticks) under FreeRTOS or __WFI() on bare metal. */
+#define LIL_TASK_IDLE(ticks) ((void)(ticks), LIL_SPIN_WAIT())
+#endif  /* LIL_TASK_IDLE */
+
+#ifndef LIL_TRACE_ENABLED
+#define LIL_TRACE_ENABLED false
+#endif  /* LIL_TRACE_ENABLED */
+
+#ifndef LIL_TRACE_EVENTS
+/* Zones each thread can record before traceFlush() must drain them; a power of two. */
+#define LIL_TRACE_EVENTS 1024
+#endif  /* LIL_TRACE_EVENTS */
+
+#ifndef LIL_TRACE_THREADS
+#define LIL_TRACE_THREADS 8
+#endif  /* LIL_TRACE_THREADS */
+
+#ifndef LIL_TRACE_TICKS_PER_US
+/* Rate of LIL_TRACE_CLOCK(), e.g. the core clock in MHz for a cycle counter; 0 calibrates against CLOCK_MONOTONIC. */
+#define LIL_TRACE_TICKS_PER_US 0
+#endif  /* LIL_TRACE_TICKS_PER_US */
+
+#ifndef LIL_REGEX_DFA_STATES
+/* Most states a Regex compiles its pattern to a DFA with, at most 255; larger automata match with the NFA instead. */
+#define LIL_REGEX_DFA_STATES 64
+#endif  /* LIL_REGEX_DFA_STATES */
+
+#ifndef LIL_CPU_LEVEL
+/* Highest lil::CpuLevel kernels run at, from 0 (Scalar) to 3 (Avx512); a CPU lacking it runs the highest it has. */
+#define LIL_CPU_LEVEL 3
+#endif  /* LIL_CPU_LEVEL */
+
+#ifndef LIL_SPIN_WAIT
+/* Statement run while spinning on another context to finish, e.g. vTaskDelay(1) under FreeRTOS. */
+#if defined(__unix__) || defined(__APPLE__)
+#include <sched.h>
+#define LIL_SPIN_WAIT() sched_yield()
+#else
+#define LIL_SPIN_WAIT() ((void)0)
+#endif
+#endif  /* LIL_SPIN_WAIT */
+
 #endif /* LIL_CONF_H_ */
@@ -0,0 +1,9 @@
+#pragma once
+
+/** @brief Expands x, then converts the result into a string literal. E.g. LIL_STRINGIFY(__LINE__) -> "42". */
+#define LIL_STRINGIFY(x) LIL_STRINGIFY_IMPL(x)
+#define LIL_STRINGIFY_IMPL(x) #x
+
+/** @brief Expands a and b, then pastes the results into one token. E.g. LIL_CONCAT(zone_, __LINE__) -> zone_42. */
+#define LIL_CONCAT(a, b) LIL_CONCAT_IMPL(a, b)
+#define LIL_CONCAT_IMPL(a, b) a##b
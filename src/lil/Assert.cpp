@@ -0,0 +1,21 @@
+#include <lil/Assert.hpp>
+
+namespace lil {
+namespace {
+std::atomic<const AssertSite*> First_Failed_Site{ nullptr };
+}  // namespace
+
+const AssertSite* AssertSite::first() noexcept
+{
+  return First_Failed_Site.load(std::memory_order_acquire);
+}
+
+void AssertSite::link() noexcept
+{
+  auto* head = First_Failed_Site.load(std::memory_order_relaxed);
+  do
+  {
+    _next = head;
+  } while (!First_Failed_Site.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+}
+}  // namespace lil
@@ -0,0 +1,74 @@
+#include <lil/Cpu.hpp>
+
+// std
+#if LIL_CPU_X86
+#  include <cpuid.h>
+#endif
+
+namespace lil {
+namespace {
+#if LIL_CPU_X86
+constexpr uint64_t Xcr0_Ymm = 0x06;  ///< SSE and AVX state.
+constexpr uint64_t Xcr0_Zmm = 0xE6;  ///< Also the opmask and both halves of the ZMM state.
+
+uint64_t readXcr0() noexcept
+{
+  uint32_t low  = 0;
+  uint32_t high = 0;
+  __asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+  return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+CpuLevel detect() noexcept
+{
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if ((__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) || ((ecx & bit_SSE4_2) == 0))
+  {
+    return CpuLevel::Scalar;
+  }
+  const auto osSaves = ((ecx & bit_OSXSAVE) != 0) ? readXcr0() : 0;
+  if ((__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) || ((ebx & bit_AVX2) == 0) ||
+      ((osSaves & Xcr0_Ymm) != Xcr0_Ymm))
+  {
+    return CpuLevel::Sse42;
+  }
+  if (((ebx & bit_AVX512F) == 0) || ((ebx & bit_AVX512BW) == 0) || ((osSaves & Xcr0_Zmm) != Xcr0_Zmm))
+  {
+    return CpuLevel::Avx2;
+  }
+  return CpuLevel::Avx512;
+}
+#else
+CpuLevel detect() noexcept
+{
+  return CpuLevel::Scalar;
+}
+#endif
+}  // namespace
+
+CpuLevel cpuDetected() noexcept
+{
+  static const auto detected = detect();
+  return detected;
+}
+
+CpuLevel cpuLevel() noexcept
+{
+  static_assert((LIL_CPU_LEVEL >= 0) && (LIL_CPU_LEVEL < Cpu_Levels), "LIL_CPU_LEVEL must name a CpuLevel");
+  const auto detected = cpuDetected();
+  return (static_cast<size_t>(detected) < LIL_CPU_LEVEL) ? detected : static_cast<CpuLevel>(LIL_CPU_LEVEL);
+}
+
+const char* cpuLevelName(CpuLevel level) noexcept
+{
+  switch (level)
+  {
+  case CpuLevel::Scalar: return "Scalar";
+  case CpuLevel::Sse42: return "SSE4.2";
+  case CpuLevel::Avx2: return "AVX2";
+  case CpuLevel::Avx512: return "AVX-512";
+  }
+  return "Unknown";
+}
+
+}  // namespace lil
@@ -1,8 +1,101 @@
 #include <lil/Err.hpp>
 
+// std
+#include <stddef.h>
+
 namespace lil {
-const char* ToString(Err err)
+namespace {
+struct ErrInfo {
+  Err         err;
+  const char* name;
+  const char* description;
+};
+
+/** @brief Indexed by Err; the static_asserts below keep it in step with the enum. */
+constexpr ErrInfo Err_Info[] = {
+  { NONE,                   "NONE",                   "No error, continue as normal." },
+  { RETRY,                  "RETRY",                  "Operation incomplete, retry." },
+  { UNKNOWN,                "UNKNOWN",                "An unknown error has occurred; system may be unstable." },
+  { KERNEL_PANIC,           "KERNEL_PANIC",           "Kernel error has occurred; abort operation." },
+  { INVALID_ARGUMENT,       "INVALID_ARGUMENT",       "Supplied argument violates required preconditions. Likely programmer or input sanitization error." },
+  { ILLEGAL_STATE,          "ILLEGAL_STATE",          "System is in a state that should not be possible." },
+  { INVALID_FORMAT,         "INVALID_FORMAT",         "Format is incorrect. E.g. format string, export format, etc." },
+  { ENCODE_FAIL,            "ENCODE_FAIL",            "Protocol data translation failed. Invalid input supplied." },
+  { DECODE_FAIL,            "DECODE_FAIL",            "Protocol data translation failed. Invalid input supplied." },
+  { OPERATION_FAILED,       "OPERATION_FAILED",       "Operation has failed in unspecified manner." },
+  { OPERATION_TIMED_OUT,    "OPERATION_TIMED_OUT",    "Operation has not completed in the allotted time." },
+  { OPERATION_ABORTED,      "OPERATION_ABORTED",      "Operation has been aborted before its successful completion." },
+  { OPERATION_UNSUPPORTED,  "OPERATION_UNSUPPORTED",  "Attempted to perform operation that cannot be properly handled." },
+  { OUT_OF_RANGE,           "OUT_OF_RANGE",           "Value or address outside of valid bounds." },
+  { NULL_POINTER,           "NULL_POINTER",           "Null pointer dereference attempt. Segmentation fault would have occurred." },
+  { DATA_CORRUPTED,         "DATA_CORRUPTED",         "Sentinel or other values do not match expected results, RAM/Flash check failure, etc." },
+  { BAD_ALLOC,              "BAD_ALLOC",              "Allocation failed. Out of heap memory, pool/arena exhausted, etc." },
+  { BAD_ALIGN,              "BAD_ALIGN",              "Value is not on properly aligned address." },
+  { ACCESS_VIOLATION,       "ACCESS_VIOLATION",       "Attempted to access invalid address. E.g. memory mapped region, unwritable memory, wrong I2C address, etc." },
+  { CHECKSUM,               "CHECKSUM",               "Checksum mismatch. E.g. bus/net protocol, hardware checks, etc." },
+  { PARITY,                 "PARITY",                 "Parity check failed." },
+  { NAK,                    "NAK",                    "NAK received." },
+  { FRAMING,                "FRAMING",                "Framing error detected." },
+  { NOISE,                  "NOISE",                  "Bus noise disrupting communication." },
+  { RESOURCE_UNINITIALIZED, "RESOURCE_UNINITIALIZED", "Attempted to use resource before it was initialized. E.g. missing init() call, not initializing a bus transaction, etc." },
+  { RESOURCE_FULL,          "RESOURCE_FULL",          "There is no more space for storage. E.g. NVM exhausted, FIFO full, Message Queue at capacity, etc." },
+  { RESOURCE_EMPTY,         "RESOURCE_EMPTY",         "There are no items to process." },
+  { RESOURCE_BUSY,          "RESOURCE_BUSY",          "The resource is being used by someone else and is unavailable." },
+  { DIVIDE_BY_ZERO,         "DIVIDE_BY_ZERO",         "Illegal division by zero." },
+  { MATH_OVERFLOW,          "MATH_OVERFLOW",          "Mathematical value overflows in manner not supported by application." },
+  { MATH_UNDERFLOW,         "MATH_UNDERFLOW",         "Mathematical value underflows in manner not supported by application." },
+  { TX_FAIL,                "TX_FAIL",                "Transmission failed for an unspecified reason." },
+  { RX_FAIL,                "RX_FAIL",                "Receiving failed for an unspecified reason." },
+  { ENDPOINT_UNREACHABLE,   "ENDPOINT_UNREACHABLE",   "Could not establish a connection." },
+  { COMMUNICATION_DROPPED,  "COMMUNICATION_DROPPED",  "A previously successful communication has been terminated." },
+  { HANDSHAKE_FAILED,       "HANDSHAKE_FAILED",       "Communications OK, but the peer did not complete the handshake." },
+  { PERMISSION_DENIED,      "PERMISSION_DENIED",      "A procedure could not be run due to insufficient permissions." },
+  { KEY_REJECTED,           "KEY_REJECTED",           "Some key was not valid. E.g. invalid key/password/hash/token." },
+  { KEY_EXPIRED,            "KEY_EXPIRED",            "Previously acceptable key/token etc. is no longer valid." },
+};
+
+constexpr size_t Err_Info_Count = sizeof(Err_Info) / sizeof(Err_Info[0]);
+
+constexpr bool isIndexedByErr() noexcept
+{
+  for (size_t i = 0; i < Err_Info_Count; ++i)
+  {
+    if (static_cast<size_t>(Err_Info[i].err) != i)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(Err_Info_Count == METL_MAX, "Every contiguous Err needs an Err_Info entry");
+static_assert(isIndexedByErr(), "Err_Info entries must be in enum order");
+
+constexpr ErrInfo User_Error_Info = { USER_ERROR, "USER_ERROR", "Application specific error." };
+constexpr ErrInfo Invalid_Info    = { ERROR_MAX, "INVALID", "Value is not an assigned error code." };
+
+constexpr const ErrInfo& info(Err err) noexcept
+{
+  const auto index = static_cast<size_t>(err);
+  if (index < Err_Info_Count)
+  {
+    return Err_Info[index];
+  }
+  if ((index >= USER_ERROR) && (index < ERROR_MAX))
+  {
+    return User_Error_Info;
+  }
+  return Invalid_Info;
+}
+}  // namespace
+
+const char* ToString(Err err) noexcept
+{
+  return info(err).name;
+}
+
+const char* Describe(Err err) noexcept
 {
-  return "";
+  return info(err).description;
 }
 }  // namespace lil
@@ -0,0 +1,74 @@
+#include <lil/Hash.hpp>
+
+// std
+#include <string.h>
+#if LIL_CPU_X86
+#  include <nmmintrin.h>
+#endif
+
+namespace lil {
+namespace {
+struct Crc32cTable {
+  uint32_t entries[256];
+
+  constexpr Crc32cTable() noexcept
+      : entries{}
+  {
+    for (uint32_t byte = 0; byte < 256; ++byte)
+    {
+      uint32_t crc = byte;
+      for (int bit = 0; bit < 8; ++bit)
+      {
+        crc = (crc >> 1) ^ (Crc32c_Poly & (0U - (crc & 1U)));
+      }
+      entries[byte] = crc;
+    }
+  }
+};
+
+constexpr Crc32cTable Crc32c_Table;
+
+uint32_t crc32cScalar(const char* data, size_t size, uint32_t seed) noexcept
+{
+  uint32_t crc = ~seed;
+  for (size_t i = 0; i < size; ++i)
+  {
+    crc = (crc >> 8) ^ Crc32c_Table.entries[(crc ^ static_cast<uint8_t>(data[i])) & 0xFFU];
+  }
+  return ~crc;
+}
+
+#if LIL_CPU_X86
+__attribute__((target("sse4.2"))) uint32_t crc32cSse42(const char* data, size_t size, uint32_t seed) noexcept
+{
+  uint64_t crc = ~seed;
+  for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), data += sizeof(uint64_t))
+  {
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    crc = _mm_crc32_u64(crc, word);
+  }
+  auto crc32 = static_cast<uint32_t>(crc);
+  for (; size > 0; --size, ++data)
+  {
+    crc32 = _mm_crc32_u8(crc32, static_cast<uint8_t>(*data));
+  }
+  return ~crc32;
+}
+#else
+constexpr detail::Crc32cFunction crc32cSse42 = nullptr;
+#endif
+}  // namespace
+
+namespace detail {
+// The wider levels would need carry-less multiply folding to beat the CRC32 instruction, so they use it too
+const Kernel<Crc32cFunction> Crc32c_Kernel{ { crc32cScalar, crc32cSse42, nullptr, nullptr } };
+
+uint32_t crc32c(const char* data, size_t size, uint32_t seed) noexcept
+{
+  static const auto resolved = Crc32c_Kernel.resolve();
+  return resolved(data, size, seed);
+}
+}  // namespace detail
+
+}  // namespace lil
@@ -0,0 +1,218 @@
+#include <lil/LineReader.hpp>
+
+// std
+#include <errno.h>
+#include <stdlib.h>
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+// local
+#include <lil/Interval.hpp>
+
+namespace lil {
+namespace {
+constexpr size_t Page = 4096;
+
+Err openError(int error) noexcept
+{
+  switch (error)
+  {
+  case EACCES:
+  case EPERM: return PERMISSION_DENIED;
+  case ENOENT:
+  case ENOTDIR: return INVALID_ARGUMENT;
+  default: return OPERATION_FAILED;
+  }
+}
+
+/** @return The last delimiter in data[0, size), or nullptr. */
+const char* findLast(const char* data, size_t size, char delimiter) noexcept
+{
+#if defined(__GLIBC__)
+  return static_cast<const char*>(memrchr(data, delimiter, size));
+#else
+  for (auto i = size; i-- > 0;)
+  {
+    if (data[i] == delimiter)
+    {
+      return data + i;
+    }
+  }
+  return nullptr;
+#endif
+}
+}  // namespace
+
+#if defined(__unix__) || defined(__APPLE__)
+Err LineReader::open(const char* path, char delimiter, Mode mode, size_t block) noexcept
+{
+  close();
+  _fd = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (_fd < 0)
+  {
+    return openError(errno);
+  }
+  _delimiter = delimiter;
+
+  struct stat status;
+  if ((mode == Mode::Map) && (fstat(_fd, &status) == 0) && S_ISREG(status.st_mode))
+  {
+    _size = static_cast<size_t>(status.st_size);
+    if (_size == 0)
+    {
+      _mapped = true;
+      return NONE;
+    }
+    void* mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (mapping != MAP_FAILED)
+    {
+      madvise(mapping, _size, MADV_SEQUENTIAL);
+      _data    = static_cast<char*>(mapping);
+      _mapped  = true;
+      _records = Records({ _data, _size }, _delimiter);
+      return NONE;
+    }
+    _size = 0;
+  }
+
+#  if defined(POSIX_FADV_SEQUENTIAL)
+  posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#  endif
+  _block = (maximum<size_t>(block, 1) + Page - 1) & ~(Page - 1);
+  _data  = static_cast<char*>(aligned_alloc(Page, _block));
+  if (_data == nullptr)
+  {
+    close();
+    return BAD_ALLOC;
+  }
+  _records = Records({}, _delimiter);
+  return NONE;
+}
+
+void LineReader::close() noexcept
+{
+  if (_mapped && (_data != nullptr))
+  {
+    munmap(_data, _size);
+  }
+  else
+  {
+    free(_data);
+  }
+  if (_fd >= 0)
+  {
+    ::close(_fd);
+  }
+  _records  = Records({}, _delimiter);
+  _pending  = {};
+  _data     = nullptr;
+  _size     = 0;
+  _block    = 0;
+  _fd       = -1;
+  _mapped   = false;
+  _ended    = false;
+  _skipping = false;
+}
+
+Result<std::string_view> LineReader::refill() noexcept
+{
+  if (_mapped || (_data == nullptr))
+  {
+    return RESOURCE_EMPTY;
+  }
+  for (;;)
+  {
+    auto filled = _pending.size();
+    if (filled > 0)
+    {
+      memmove(_data, _pending.data(), filled);
+    }
+    _pending = {};
+    if (_ended)
+    {
+      // The last record has no delimiter after it
+      _records = Records({ _data, filled }, _delimiter);
+      return _records.next();
+    }
+    if (filled == _block)
+    {
+      // Too long for the buffer: return what fits, and drop the rest
+      _skipping = true;
+      return std::string_view(_data, filled);
+    }
+
+    const auto count = ::read(_fd, _data + filled, _block - filled);
+    if (count < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return RX_FAIL;
+    }
+    _ended = (count == 0);
+    filled += static_cast<size_t>(count);
+
+    size_t begin = 0;
+    if (_skipping)
+    {
+      const auto* end = static_cast<const char*>(memchr(_data, _delimiter, filled));
+      _skipping       = (end == nullptr) && !_ended;
+      begin           = (end == nullptr) ? filled : static_cast<size_t>(end - _data) + 1;
+    }
+    const auto* last     = findLast(_data + begin, filled - begin, _delimiter);
+    const auto  complete = (last == nullptr) ? begin : static_cast<size_t>(last - _data) + 1;
+    _pending             = { _data + complete, filled - complete };
+    _records             = Records({ _data + begin, complete - begin }, _delimiter);
+    if (auto record = _records.next())
+    {
+      return record;
+    }
+  }
+}
+#else
+Err LineReader::open(const char*, char, Mode, size_t) noexcept
+{
+  return OPERATION_UNSUPPORTED;
+}
+
+void LineReader::close() noexcept
+{
+}
+
+Result<std::string_view> LineReader::refill() noexcept
+{
+  return RESOURCE_EMPTY;
+}
+#endif
+
+size_t LineReader::split(std::string_view* chunks, size_t count) noexcept
+{
+  if (!_mapped || (count == 0))
+  {
+    return 0;
+  }
+  auto         rest   = _records.rest();
+  const size_t target = maximum<size_t>(rest.size() / count, 1);
+  size_t       chunk  = 0;
+  while (!rest.empty())
+  {
+    auto size = rest.size();
+    if (((chunk + 1) < count) && (size > target))
+    {
+      // Ends the chunk at the first delimiter from the end of its share of the text
+      const auto* end = static_cast<const char*>(memchr(rest.data() + target - 1, _delimiter, size - target + 1));
+      size            = (end == nullptr) ? size : static_cast<size_t>(end - rest.data()) + 1;
+    }
+    chunks[chunk++] = rest.substr(0, size);
+    rest.remove_prefix(size);
+  }
+  _records = Records({}, _delimiter);
+  return chunk;
+}
+
+}  // namespace lil
@@ -0,0 +1,49 @@
+#include <lil/Log.hpp>
+
+namespace lil {
+namespace {
+LogBuffer             Log_Buffer;
+std::atomic<uint32_t> Log_Dropped{ 0 };   ///< Total records dropped.
+std::atomic<uint32_t> Log_Reported{ 0 };  ///< Drops announced in the stream, or being announced.
+}  // namespace
+
+LogBuffer& logBuffer() noexcept
+{
+  return Log_Buffer;
+}
+
+uint32_t logDropped() noexcept
+{
+  return Log_Dropped.load(std::memory_order_relaxed);
+}
+
+namespace detail {
+void logPush(const void* record, size_t size) noexcept
+{
+  auto       reported = Log_Reported.load(std::memory_order_relaxed);
+  const auto dropped  = Log_Dropped.load(std::memory_order_relaxed);
+  // Only the producer that claims the unreported drops announces them
+  if ((dropped != reported) && Log_Reported.compare_exchange_strong(reported, dropped, std::memory_order_relaxed))
+  {
+    uint8_t    notice[sizeof(Log_Dropped_Id) + sizeof(dropped)];
+    const auto count = dropped - reported;
+    memcpy(&notice[0], &Log_Dropped_Id, sizeof(Log_Dropped_Id));
+    memcpy(&notice[sizeof(Log_Dropped_Id)], &count, sizeof(count));
+    if (Log_Buffer.write(notice, sizeof(notice)) != Err::NONE)
+    {
+      Log_Reported.fetch_sub(count, std::memory_order_relaxed);
+      Log_Dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+  if (Log_Buffer.write(record, size) != Err::NONE)
+  {
+    Log_Dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void logCheck(const char*, ...) noexcept
+{
+}
+}  // namespace detail
+}  // namespace lil
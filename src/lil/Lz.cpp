@@ -0,0 +1,236 @@
+#include <lil/Lz.hpp>
+
+namespace lil {
+namespace {
+constexpr size_t Min_Match        = 4;      ///< LZ4 stores match lengths minus this.
+constexpr size_t Last_Literals    = 5;      ///< A block ends with at least this many literals...
+constexpr size_t Match_Find_Limit = 12;     ///< ...and its last match starts at least this far from the end.
+constexpr size_t Max_Distance     = 65535;  ///< Farthest a match can look back.
+constexpr size_t Length_Max       = 15;     ///< Largest length a token holds; longer ones continue in 255s.
+constexpr size_t Skip_Trigger     = 6;      ///< Misses in a row, as a power of two, before the search steps further.
+
+uint32_t load32(const uint8_t* data) noexcept
+{
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+uint64_t load64(const uint8_t* data) noexcept
+{
+  uint64_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+size_t hash(uint32_t sequence, uint8_t hashBits) noexcept
+{
+  return (sequence * 2654435761U) >> (32 - hashBits);
+}
+
+/** @brief Bytes a token's length takes after the token, when it does not fit in its 4 bits. */
+constexpr size_t lengthBytes(size_t length) noexcept
+{
+  return (length < Length_Max) ? 0 : (((length - Length_Max) / 255) + 1);
+}
+
+uint8_t* writeLength(uint8_t* out, size_t length) noexcept
+{
+  if (length >= Length_Max)
+  {
+    for (length -= Length_Max; length >= 255; length -= 255)
+    {
+      *out++ = 255;
+    }
+    *out++ = static_cast<uint8_t>(length);
+  }
+  return out;
+}
+
+/** @brief Writes literals, then a match unless length is 0. @return The end of the sequence, or nullptr if it does
+ * not fit before end.
+ */
+uint8_t* writeSequence(uint8_t* out, const uint8_t* end, const uint8_t* literals, size_t count, size_t distance,
+                       size_t length) noexcept
+{
+  const auto matched = (length > 0) ? (length - Min_Match) : 0;
+  const auto needed  = 1 + lengthBytes(count) + count + ((length > 0) ? (2 + lengthBytes(matched)) : 0);
+  if (static_cast<size_t>(end - out) < needed)
+  {
+    return nullptr;
+  }
+  *out++ = static_cast<uint8_t>((minimum(count, Length_Max) << 4) | minimum(matched, Length_Max));
+  out    = writeLength(out, count);
+  if (count > 0)
+  {
+    memcpy(out, literals, count);
+    out += count;
+  }
+  if (length > 0)
+  {
+    *out++ = static_cast<uint8_t>(distance);
+    *out++ = static_cast<uint8_t>(distance >> 8);
+    out    = writeLength(out, matched);
+  }
+  return out;
+}
+
+/** @brief Adds the continuation bytes of a token's length at in to length. @return false if the block ends first. */
+bool readLength(const uint8_t*& in, const uint8_t* end, size_t& length) noexcept
+{
+  if (length < Length_Max)
+  {
+    return true;
+  }
+  uint8_t byte = 255;
+  while (byte == 255)
+  {
+    if (in == end)
+    {
+      return false;
+    }
+    byte    = *in++;
+    length += byte;
+  }
+  return true;
+}
+}  // namespace
+
+namespace detail {
+Result<size_t> lz4Compress(uint32_t* table, uint8_t hashBits, const uint8_t* data, size_t size, uint8_t* out,
+                           size_t capacity) noexcept
+{
+  if (size > UINT32_MAX)
+  {
+    return INVALID_ARGUMENT;
+  }
+  const auto*    end      = data + size;
+  const auto*    outEnd   = out + capacity;
+  auto*          op       = out;
+  const uint8_t* anchor   = data;  // First byte not yet written
+  const uint8_t* position = data;
+  if (size > Match_Find_Limit)
+  {
+    const auto* matchLimit = end - Last_Literals;
+    const auto* findLimit  = end - Match_Find_Limit;
+    size_t      misses     = 0;
+    while (position <= findLimit)
+    {
+      const auto sequence = load32(position);
+      const auto current  = static_cast<uint32_t>(position - data);
+      auto&      entry    = table[hash(sequence, hashBits)];
+      const auto previous = entry;
+      entry               = current;
+      if ((previous >= current) || ((current - previous) > Max_Distance) || (load32(data + previous) != sequence))
+      {
+        // Steps further through data that does not compress
+        position += 1 + (misses++ >> Skip_Trigger);
+        continue;
+      }
+      misses = 0;
+
+      const auto* candidate = data + previous;
+      while ((position > anchor) && (candidate > data) && (position[-1] == candidate[-1]))
+      {
+        --position;
+        --candidate;
+      }
+      const auto* matchEnd = position + Min_Match;
+      const auto* from     = candidate + Min_Match;
+      for (; ((matchEnd + sizeof(uint64_t)) <= matchLimit) && (load64(matchEnd) == load64(from));
+           matchEnd += sizeof(uint64_t), from += sizeof(uint64_t))
+      {
+      }
+      for (; (matchEnd < matchLimit) && (*matchEnd == *from); ++matchEnd, ++from)
+      {
+      }
+
+      op = writeSequence(op, outEnd, anchor, static_cast<size_t>(position - anchor),
+                         static_cast<size_t>(position - candidate), static_cast<size_t>(matchEnd - position));
+      if (op == nullptr)
+      {
+        return RESOURCE_FULL;
+      }
+      // Remembers a position inside the match too, which finds the next match sooner in repetitive data
+      table[hash(load32(matchEnd - 2), hashBits)] = static_cast<uint32_t>(matchEnd - 2 - data);
+      position = anchor = matchEnd;
+    }
+  }
+
+  op = writeSequence(op, outEnd, anchor, static_cast<size_t>(end - anchor), 0, 0);
+  if (op == nullptr)
+  {
+    return RESOURCE_FULL;
+  }
+  return static_cast<size_t>(op - out);
+}
+}  // namespace detail
+
+Result<size_t> lz4Decompress(const void* data, size_t size, void* out, size_t capacity) noexcept
+{
+  const auto* in     = static_cast<const uint8_t*>(data);
+  const auto* end    = in + size;
+  auto*       begin  = static_cast<uint8_t*>(out);
+  auto*       op     = begin;
+  const auto* outEnd = begin + capacity;
+  for (;;)
+  {
+    if (in == end)
+    {
+      return DECODE_FAIL;  // Blocks end with literals, even if there are none
+    }
+    const auto token   = *in++;
+    size_t     literal = token >> 4;
+    if (!readLength(in, end, literal) || (static_cast<size_t>(end - in) < literal))
+    {
+      return DECODE_FAIL;
+    }
+    if (static_cast<size_t>(outEnd - op) < literal)
+    {
+      return RESOURCE_FULL;
+    }
+    if (literal > 0)
+    {
+      memcpy(op, in, literal);
+      in += literal;
+      op += literal;
+    }
+    if (in == end)
+    {
+      return static_cast<size_t>(op - begin);
+    }
+
+    if ((end - in) < 2)
+    {
+      return DECODE_FAIL;
+    }
+    const size_t distance = in[0] | (size_t(in[1]) << 8);
+    in += 2;
+    size_t length = token & Length_Max;
+    if ((distance == 0) || (distance > static_cast<size_t>(op - begin)) || !readLength(in, end, length))
+    {
+      return DECODE_FAIL;
+    }
+    length += Min_Match;
+    if (static_cast<size_t>(outEnd - op) < length)
+    {
+      return RESOURCE_FULL;
+    }
+    const auto* match = op - distance;
+    if (distance >= length)
+    {
+      memcpy(op, match, length);
+      op += length;
+    }
+    else
+    {
+      // Overlapping matches repeat the last distance bytes
+      for (size_t i = 0; i < length; ++i)
+      {
+        *op++ = match[i];
+      }
+    }
+  }
+}
+
+}  // namespace lil
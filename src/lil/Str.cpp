@@ -0,0 +1,25 @@
+#include <lil/Str.hpp>
+
+namespace lil {
+namespace detail {
+void strAssign(char* data, size_t capacity, const char* str, size_t count) noexcept
+{
+  StrCore::assign(data, capacity, str, count);
+}
+
+void strInsert(char* data, size_t capacity, size_t index, size_t count, char fill) noexcept
+{
+  StrCore::insert(data, capacity, index, count, fill);
+}
+
+void strInsert(char* data, size_t capacity, size_t index, const char* str, size_t count) noexcept
+{
+  StrCore::insert(data, capacity, index, str, count);
+}
+
+void strErase(char* data, size_t capacity, size_t index, size_t count) noexcept
+{
+  StrCore::erase(data, capacity, index, count);
+}
+}  // namespace detail
+}  // namespace lil
@@ -0,0 +1,194 @@
+#include <lil/Task.hpp>
+
+namespace lil {
+namespace {
+TaskFramePool Task_Frame_Pool;
+
+void unlink(detail::Waiter*& head, detail::Waiter& waiter, detail::Waiter* detail::Waiter::*link) noexcept
+{
+  for (auto** node = &head; *node != nullptr; node = &((*node)->*link))
+  {
+    if (*node == &waiter)
+    {
+      *node = waiter.*link;
+      break;
+    }
+  }
+  waiter.*link = nullptr;
+}
+}  // namespace
+
+TaskFramePool& taskFramePool() noexcept
+{
+  return Task_Frame_Pool;
+}
+
+namespace detail {
+std::coroutine_handle<> PromiseBase::finish(std::coroutine_handle<> frame) noexcept
+{
+  if (continuation)
+  {
+    return continuation;
+  }
+  if (executor != nullptr)
+  {
+    --executor->_tasks;
+  }
+  if (detached)
+  {
+    frame.destroy();
+  }
+  return std::noop_coroutine();
+}
+}  // namespace detail
+
+Err Executor::start(std::coroutine_handle<> handle, detail::PromiseBase* promise, bool detached) noexcept
+{
+  if (promise == nullptr)
+  {
+    return BAD_ALLOC;
+  }
+  promise->executor     = this;
+  promise->detached     = detached;
+  promise->root.handle  = handle;
+  promise->root.executor = this;
+  ++_tasks;
+  schedule(promise->root);
+  return NONE;
+}
+
+void Executor::schedule(detail::Waiter& waiter) noexcept
+{
+  waiter.next = nullptr;
+  if (_readyTail == nullptr)
+  {
+    _ready = &waiter;
+  }
+  else
+  {
+    _readyTail->next = &waiter;
+  }
+  _readyTail = &waiter;
+}
+
+void Executor::wait(detail::Waiter& waiter, uint32_t timeout) noexcept
+{
+  if (waiter.event != nullptr)
+  {
+    waiter.next              = waiter.event->_waiters;
+    waiter.event->_waiters = &waiter;
+  }
+  else if (waiter.ready != nullptr)
+  {
+    waiter.next = _polled;
+    _polled     = &waiter;
+  }
+  else if (timeout == 0)
+  {
+    waiter.result = NONE;
+    schedule(waiter);
+    return;
+  }
+
+  if (timeout != Forever)
+  {
+    waiter.timed    = true;
+    waiter.deadline = _clock() + timeout;
+    auto** node     = &_timers;
+    while ((*node != nullptr) && (static_cast<int32_t>((*node)->deadline - waiter.deadline) <= 0))
+    {
+      node = &(*node)->nextTimer;
+    }
+    waiter.nextTimer = *node;
+    *node            = &waiter;
+  }
+}
+
+void Executor::wake(detail::Waiter& waiter, Err result) noexcept
+{
+  if (waiter.timed)
+  {
+    unlink(_timers, waiter, &detail::Waiter::nextTimer);
+    waiter.timed = false;
+  }
+  if (waiter.event != nullptr)
+  {
+    unlink(waiter.event->_waiters, waiter, &detail::Waiter::next);
+    waiter.event = nullptr;
+  }
+  else if (waiter.ready != nullptr)
+  {
+    unlink(_polled, waiter, &detail::Waiter::next);
+    waiter.ready = nullptr;
+  }
+  waiter.result = result;
+  schedule(waiter);
+}
+
+size_t Executor::runOnce() noexcept
+{
+  const auto now = _clock();
+  while ((_timers != nullptr) && (static_cast<int32_t>(_timers->deadline - now) <= 0))
+  {
+    wake(*_timers, _timers->expired);
+  }
+  for (auto* waiter = _polled; waiter != nullptr;)
+  {
+    auto* next = waiter->next;
+    if (waiter->ready(waiter->context, waiter->argument))
+    {
+      wake(*waiter, NONE);
+    }
+    waiter = next;
+  }
+
+  // Only run what is ready now, so a task that yields cannot starve the timers and polled waits
+  auto*  batch   = _ready;
+  size_t resumed = 0;
+  _ready         = nullptr;
+  _readyTail     = nullptr;
+  while (batch != nullptr)
+  {
+    auto* waiter = batch;
+    batch        = waiter->next;
+    waiter->handle.resume();
+    ++resumed;
+  }
+  return resumed;
+}
+
+void Executor::run() noexcept
+{
+  while (_tasks != 0)
+  {
+    runOnce();
+    if (_ready == nullptr)
+    {
+      LIL_TASK_IDLE(idleTicks());
+    }
+  }
+}
+
+uint32_t Executor::idleTicks() const noexcept
+{
+  if ((_ready != nullptr) || (_polled != nullptr))
+  {
+    return 0;
+  }
+  if (_timers == nullptr)
+  {
+    return Forever;
+  }
+  const auto remaining = static_cast<int32_t>(_timers->deadline - _clock());
+  return (remaining > 0) ? static_cast<uint32_t>(remaining) : 0;
+}
+
+void Event::set() noexcept
+{
+  _set = true;
+  while (_waiters != nullptr)
+  {
+    _waiters->executor->wake(*_waiters, NONE);
+  }
+}
+}  // namespace lil
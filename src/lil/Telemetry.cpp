@@ -0,0 +1,165 @@
+#include <lil/Telemetry.hpp>
+
+// std
+#include <string.h>
+
+namespace lil {
+namespace detail {
+ErrShard Err_Shards[Telemetry_Shards] = {};
+
+namespace {
+size_t appendDecimal(uint32_t value, char* out) noexcept
+{
+  char   reversed[10];
+  size_t digits = 0;
+  do
+  {
+    reversed[digits++] = static_cast<char>('0' + (value % 10));
+    value /= 10;
+  } while (value != 0);
+  for (size_t i = 0; i < digits; ++i)
+  {
+    out[i] = reversed[digits - 1 - i];
+  }
+  return digits;
+}
+
+size_t appendText(const char* text, char* out) noexcept
+{
+  const auto length = strlen(text);
+  memcpy(out, text, length);
+  return length;
+}
+}  // namespace
+
+size_t formatErrCount(Err err, uint32_t count, char* out) noexcept
+{
+  size_t length = appendText(ToString(err), out);
+  if ((err >= USER_ERROR) && (err < ERROR_MAX))
+  {
+    out[length++] = '+';
+    length += appendDecimal(err - USER_ERROR, &out[length]);
+  }
+  out[length++] = '=';
+  length += appendDecimal(count, &out[length]);
+  return length;
+}
+}  // namespace detail
+
+namespace {
+class Writer {
+public:
+  Writer(void* out, size_t size) noexcept
+      : _out(static_cast<uint8_t*>(out))
+      , _size(size)
+      , _written(0)
+  {
+  }
+
+  bool fits(size_t count) const noexcept { return (_size - _written) >= count; }
+  size_t written() const noexcept { return _written; }
+
+  void put(uint32_t value, size_t bytes) noexcept
+  {
+    for (size_t i = 0; i < bytes; ++i)
+    {
+      _out[_written++] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+private:
+  uint8_t* _out;
+  size_t   _size;
+  size_t   _written;
+};
+}  // namespace
+
+ErrSnapshot ErrSnapshot::take() noexcept
+{
+  ErrSnapshot snapshot;
+  for (size_t i = 0; i < ERROR_MAX; ++i)
+  {
+    uint32_t sum = 0;
+    for (const auto& shard : detail::Err_Shards)
+    {
+      sum += shard.counts[i].load(std::memory_order_relaxed);
+    }
+    snapshot._counts[i] = sum;
+  }
+  return snapshot;
+}
+
+uint32_t ErrSnapshot::total() const noexcept
+{
+  uint32_t sum = 0;
+  for (size_t i = 1; i < ERROR_MAX; ++i)
+  {
+    sum += _counts[i];
+  }
+  return sum;
+}
+
+ErrSnapshot ErrSnapshot::operator-(const ErrSnapshot& earlier) const noexcept
+{
+  ErrSnapshot difference;
+  for (size_t i = 0; i < ERROR_MAX; ++i)
+  {
+    difference._counts[i] = _counts[i] - earlier._counts[i];
+  }
+  return difference;
+}
+
+Result<size_t> serialize(const ErrSnapshot& snapshot, void* out, size_t size) noexcept
+{
+  constexpr size_t Entry_Bytes = sizeof(uint16_t) + sizeof(uint32_t);
+
+  uint16_t entries = 0;
+  for (size_t i = 0; i < ERROR_MAX; ++i)
+  {
+    entries += (snapshot[static_cast<Err>(i)] != 0) ? 1 : 0;
+  }
+
+  Writer writer(out, size);
+  if (!writer.fits(sizeof(entries) + (entries * Entry_Bytes)))
+  {
+    return RESOURCE_FULL;
+  }
+  writer.put(entries, sizeof(entries));
+  for (size_t i = 0; i < ERROR_MAX; ++i)
+  {
+    const auto count = snapshot[static_cast<Err>(i)];
+    if (count != 0)
+    {
+      writer.put(static_cast<uint32_t>(i), sizeof(uint16_t));
+      writer.put(count, sizeof(count));
+    }
+  }
+  return writer.written();
+}
+
+Result<size_t> serializeAsserts(void* out, size_t size) noexcept
+{
+  constexpr size_t Site_Bytes = 2 * sizeof(uint32_t);
+
+  uint16_t sites = 0;
+  for (auto* site = AssertSite::first(); site != nullptr; site = site->next())
+  {
+    ++sites;
+  }
+
+  Writer writer(out, size);
+  if (!writer.fits(sizeof(sites) + (sites * Site_Bytes)))
+  {
+    return RESOURCE_FULL;
+  }
+  writer.put(sites, sizeof(sites));
+  // Sites are only ever pushed at the front, so the first sites entries are the ones counted
+  auto* site = AssertSite::first();
+  for (uint16_t i = 0; i < sites; ++i, site = site->next())
+  {
+    writer.put(site->id(), sizeof(uint32_t));
+    writer.put(site->failures(), sizeof(uint32_t));
+  }
+  return writer.written();
+}
+}  // namespace lil
@@ -0,0 +1,217 @@
+#include <lil/Trace.hpp>
+
+// std
+#include <string.h>
+#if defined(__unix__) || defined(__APPLE__)
+#  include <time.h>
+#else
+#  include <chrono>
+#endif
+
+namespace lil {
+namespace detail {
+uint64_t traceClock() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (static_cast<uint64_t>(now.tv_sec) * 1000000000U) + static_cast<uint64_t>(now.tv_nsec);
+#else
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+#endif
+}
+}  // namespace detail
+
+namespace {
+constexpr size_t   Name_Chars     = 96;       ///< Longest zone name written; longer names are truncated.
+constexpr uint64_t Calibration_Ns = 1000000;  ///< Shortest interval LIL_TRACE_CLOCK() is calibrated over.
+
+struct ClockSample {
+  uint64_t ticks;
+  uint64_t ns;
+};
+
+ClockSample sampleClock() noexcept
+{
+#if LIL_TRACE_TICKS_PER_US == 0
+  return { LIL_TRACE_CLOCK(), detail::traceClock() };
+#else
+  return { LIL_TRACE_CLOCK(), 0 };
+#endif
+}
+
+detail::TraceBuffer   Trace_Buffers[LIL_TRACE_THREADS];
+std::atomic<uint32_t> Trace_Dropped{ 0 };
+const ClockSample     Trace_Origin  = sampleClock();  ///< Timestamps are written relative to this.
+bool                  Trace_Started = false;          ///< Whether the opening bracket has been written.
+
+/** @brief Returns the rate of LIL_TRACE_CLOCK(), measuring it against CLOCK_MONOTONIC since startup if unknown. */
+double ticksPerNs() noexcept
+{
+#if LIL_TRACE_TICKS_PER_US == 0
+  auto now = sampleClock();
+  while ((now.ns - Trace_Origin.ns) < Calibration_Ns)
+  {
+    now = sampleClock();
+  }
+  return static_cast<double>(now.ticks - Trace_Origin.ticks) / static_cast<double>(now.ns - Trace_Origin.ns);
+#else
+  return LIL_TRACE_TICKS_PER_US / 1000.0;
+#endif
+}
+
+/** @brief Returns the buffer of a thread that has exited to the pool. */
+struct Release {
+  detail::TraceBuffer* buffer = nullptr;
+
+  ~Release()
+  {
+    if (buffer != nullptr)
+    {
+      detail::Trace_Buffer = nullptr;
+      buffer->claimed.store(false, std::memory_order_release);
+    }
+  }
+};
+
+size_t appendDecimal(uint64_t value, char* out) noexcept
+{
+  char   reversed[20];
+  size_t digits = 0;
+  do
+  {
+    reversed[digits++] = static_cast<char>('0' + (value % 10));
+    value /= 10;
+  } while (value != 0);
+  for (size_t i = 0; i < digits; ++i)
+  {
+    out[i] = reversed[digits - 1 - i];
+  }
+  return digits;
+}
+
+size_t appendText(const char* text, char* out) noexcept
+{
+  const auto length = strlen(text);
+  memcpy(out, text, length);
+  return length;
+}
+
+/** @brief Appends ns as microseconds with three decimals, the unit Chrome trace events use. */
+size_t appendMicroseconds(uint64_t ns, char* out) noexcept
+{
+  size_t length = appendDecimal(ns / 1000, out);
+  out[length++] = '.';
+  const auto fraction = static_cast<uint32_t>(ns % 1000);
+  out[length++]       = static_cast<char>('0' + (fraction / 100));
+  out[length++]       = static_cast<char>('0' + ((fraction / 10) % 10));
+  out[length++]       = static_cast<char>('0' + (fraction % 10));
+  return length;
+}
+
+/** @brief Appends name as the body of a JSON string, dropping control characters. */
+size_t appendName(const char* name, char* out) noexcept
+{
+  size_t length = 0;
+  for (size_t i = 0; (i < Name_Chars) && (name[i] != '\0'); ++i)
+  {
+    const auto c = name[i];
+    if ((c == '"') || (c == '\\'))
+    {
+      out[length++] = '\\';
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      continue;
+    }
+    out[length++] = c;
+  }
+  return length;
+}
+
+size_t formatEvent(const detail::TraceEvent& event, uint32_t thread, double rate, char* out) noexcept
+{
+  const auto begin    = (event.begin > Trace_Origin.ticks) ? (event.begin - Trace_Origin.ticks) : 0;
+  const auto duration = (event.end > event.begin) ? (event.end - event.begin) : 0;
+
+  size_t length = appendText("{\"name\":\"", out);
+  length += appendName(event.name, &out[length]);
+  length += appendText("\",\"ph\":\"X\",\"ts\":", &out[length]);
+  length += appendMicroseconds(static_cast<uint64_t>(static_cast<double>(begin) / rate), &out[length]);
+  length += appendText(",\"dur\":", &out[length]);
+  length += appendMicroseconds(static_cast<uint64_t>(static_cast<double>(duration) / rate), &out[length]);
+  length += appendText(",\"pid\":1,\"tid\":", &out[length]);
+  length += appendDecimal(thread, &out[length]);
+  length += appendText("},\n", &out[length]);
+  return length;
+}
+}  // namespace
+
+namespace detail {
+TraceBuffer* traceClaim() noexcept
+{
+  // A buffer is only handed on once its last owner's zones have been flushed, so their thread IDs stay distinct
+  for (auto& buffer : Trace_Buffers)
+  {
+    bool claimed = false;
+    if ((buffer.head.load(std::memory_order_relaxed) == buffer.tail.load(std::memory_order_acquire)) &&
+        buffer.claimed.compare_exchange_strong(claimed, true, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+      thread_local Release release;
+      release.buffer = &buffer;
+      Trace_Buffer   = &buffer;
+      return &buffer;
+    }
+  }
+  traceDrop();
+  return nullptr;
+}
+
+void traceDrop() noexcept
+{
+  Trace_Dropped.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace detail
+
+Result<size_t> traceFlush(char* out, size_t size) noexcept
+{
+  const auto rate    = ticksPerNs();
+  size_t     written = 0;
+  if (!Trace_Started)
+  {
+    if (size < (2 + Trace_Event_Chars))
+    {
+      return RESOURCE_FULL;
+    }
+    written       = appendText("[\n", out);
+    Trace_Started = true;
+  }
+  for (uint32_t i = 0; i < LIL_TRACE_THREADS; ++i)
+  {
+    auto&      buffer = Trace_Buffers[i];
+    auto       tail   = buffer.tail.load(std::memory_order_relaxed);
+    const auto head   = buffer.head.load(std::memory_order_acquire);
+    for (; tail != head; ++tail)
+    {
+      if ((size - written) < Trace_Event_Chars)
+      {
+        buffer.tail.store(tail, std::memory_order_release);
+        if (written == 0)
+        {
+          return RESOURCE_FULL;
+        }
+        return written;
+      }
+      written += formatEvent(buffer.events[tail & (detail::Trace_Events - 1)], i + 1, rate, &out[written]);
+    }
+    buffer.tail.store(tail, std::memory_order_release);
+  }
+  return written;
+}
+
+uint32_t traceDropped() noexcept
+{
+  return Trace_Dropped.load(std::memory_order_relaxed);
+}
+}  // namespace lil
@@ -0,0 +1,183 @@
+#include <lil/Utf8.hpp>
+
+// std
+#if LIL_CPU_X86
+#  include <immintrin.h>
+#endif
+
+namespace lil {
+namespace {
+/** @return Bytes in the well-formed sequence starting data[0, size), or 0 if it is malformed. */
+size_t sequenceLength(const uint8_t* data, size_t size) noexcept
+{
+  const auto lead   = data[0];
+  size_t     length = 0;
+  uint8_t    low    = 0x80;  // Bounds of the second byte, narrowed to exclude overlongs, surrogates and > U+10FFFF
+  uint8_t    high   = 0xBF;
+  if (lead < 0x80)
+  {
+    return 1;
+  }
+  else if (lead < 0xC2)
+  {
+    return 0;
+  }
+  else if (lead < 0xE0)
+  {
+    length = 2;
+  }
+  else if (lead < 0xF0)
+  {
+    length = 3;
+    low    = (lead == 0xE0) ? 0xA0 : low;
+    high   = (lead == 0xED) ? 0x9F : high;
+  }
+  else if (lead < 0xF5)
+  {
+    length = 4;
+    low    = (lead == 0xF0) ? 0x90 : low;
+    high   = (lead == 0xF4) ? 0x8F : high;
+  }
+  else
+  {
+    return 0;
+  }
+
+  if ((size < length) || (data[1] < low) || (data[1] > high))
+  {
+    return 0;
+  }
+  for (size_t i = 2; i < length; ++i)
+  {
+    if ((data[i] & 0xC0) != 0x80)
+    {
+      return 0;
+    }
+  }
+  return length;
+}
+
+/** @brief Validates sequences from index until one ends at or beyond end, leaving index after it. */
+bool validateTo(const uint8_t* data, size_t size, size_t& index, size_t end) noexcept
+{
+  while (index < end)
+  {
+    const auto length = sequenceLength(&data[index], size - index);
+    if (length == 0)
+    {
+      return false;
+    }
+    index += length;
+  }
+  return true;
+}
+
+#if LIL_CPU_X86
+/** @brief Validates the sequences of the run of non-ASCII bytes at index, leaving index after it. */
+bool validateRun(const uint8_t* data, size_t size, size_t& index) noexcept
+{
+  while ((index < size) && (data[index] >= 0x80))
+  {
+    const auto length = sequenceLength(&data[index], size - index);
+    if (length == 0)
+    {
+      return false;
+    }
+    index += length;
+  }
+  return true;
+}
+#endif
+
+bool utf8ValidScalar(const char* data, size_t size) noexcept
+{
+  size_t index = 0;
+  return validateTo(reinterpret_cast<const uint8_t*>(data), size, index, size);
+}
+
+#if LIL_CPU_X86
+// Each skips vectors of ASCII, and from any other skips to its first non-ASCII byte to validate the run starting there
+__attribute__((target("sse4.2"))) bool utf8ValidSse42(const char* data, size_t size) noexcept
+{
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+  size_t      index = 0;
+  while ((index + sizeof(__m128i)) <= size)
+  {
+    const auto vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&bytes[index]));
+    const auto mask   = _mm_movemask_epi8(vector);
+    if (mask == 0)
+    {
+      index += sizeof(__m128i);
+      continue;
+    }
+    index += __builtin_ctz(static_cast<unsigned>(mask));
+    if (!validateRun(bytes, size, index))
+    {
+      return false;
+    }
+  }
+  return validateTo(bytes, size, index, size);
+}
+
+__attribute__((target("avx2"))) bool utf8ValidAvx2(const char* data, size_t size) noexcept
+{
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+  size_t      index = 0;
+  while ((index + sizeof(__m256i)) <= size)
+  {
+    const auto vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&bytes[index]));
+    const auto mask   = _mm256_movemask_epi8(vector);
+    if (mask == 0)
+    {
+      index += sizeof(__m256i);
+      continue;
+    }
+    index += __builtin_ctz(static_cast<unsigned>(mask));
+    if (!validateRun(bytes, size, index))
+    {
+      return false;
+    }
+  }
+  return validateTo(bytes, size, index, size);
+}
+
+__attribute__((target("avx512f,avx512bw"))) bool utf8ValidAvx512(const char* data, size_t size) noexcept
+{
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+  size_t      index = 0;
+  while ((index + sizeof(__m512i)) <= size)
+  {
+    const auto vector = _mm512_loadu_si512(&bytes[index]);
+    const auto mask   = _mm512_movepi8_mask(vector);
+    if (mask == 0)
+    {
+      index += sizeof(__m512i);
+      continue;
+    }
+    index += __builtin_ctzll(mask);
+    if (!validateRun(bytes, size, index))
+    {
+      return false;
+    }
+  }
+  return validateTo(bytes, size, index, size);
+}
+#else
+constexpr detail::Utf8ValidFunction utf8ValidSse42  = nullptr;
+constexpr detail::Utf8ValidFunction utf8ValidAvx2   = nullptr;
+constexpr detail::Utf8ValidFunction utf8ValidAvx512 = nullptr;
+#endif
+}  // namespace
+
+namespace detail {
+const Kernel<Utf8ValidFunction> Utf8_Valid_Kernel{ { utf8ValidScalar, utf8ValidSse42, utf8ValidAvx2,
+                                                     utf8ValidAvx512 } };
+}  // namespace detail
+
+bool utf8Valid(const char* data, size_t size) noexcept
+{
+  static const auto resolved = detail::Utf8_Valid_Kernel.resolve();
+  return resolved(data, size);
+}
+
+}  // namespace lil
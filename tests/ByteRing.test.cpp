@@ -0,0 +1,102 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/ByteRing.hpp>
+#include <thread>
+#include <vector>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+TEST(ByteRingTest, ReadsBackWhatWasWritten)
+{
+  ByteRing<8>   ring;
+  const uint8_t in[] = { 1, 2, 3 };
+  uint8_t       out[4]{};
+
+  ASSERT_EQ(Err::NONE, ring.write(in, sizeof(in)));
+  ASSERT_EQ(3U, ring.size());
+  ASSERT_EQ(3U, ring.read(out, sizeof(out)));
+  ASSERT_THAT(out, ElementsAre(1, 2, 3, 0));
+  ASSERT_TRUE(ring.empty());
+}
+
+TEST(ByteRingTest, WritesAreAllOrNothing)
+{
+  ByteRing<4>   ring;
+  const uint8_t in[] = { 1, 2, 3 };
+
+  ASSERT_EQ(Err::NONE, ring.write(in, sizeof(in)));
+  ASSERT_EQ(Err::RESOURCE_FULL, ring.write(in, 2));
+  ASSERT_EQ(Err::NONE, ring.write(in, 1));
+  ASSERT_EQ(4U, ring.size());
+}
+
+TEST(ByteRingTest, WrapsAroundTheEnd)
+{
+  ByteRing<4>   ring;
+  const uint8_t in[] = { 1, 2, 3 };
+  uint8_t       out[3]{};
+
+  ring.write(in, 3);
+  ring.read(out, 2);
+  ASSERT_EQ(Err::NONE, ring.write(in, 3));
+  ASSERT_EQ(3U, ring.read(out, 3));
+  ASSERT_THAT(out, ElementsAre(3, 1, 2));
+  ASSERT_EQ(1U, ring.read(out, 3));
+  ASSERT_EQ(3, out[0]);
+}
+
+TEST(ByteRingTest, ProducersWriteWholeRecordsConcurrently)
+{
+  constexpr uint32_t Producers = 4;
+  constexpr uint32_t Records   = 5000;
+
+  static MpscByteRing<256> ring;
+  std::vector<std::thread> producers;
+  for (uint32_t producer = 0; producer < Producers; ++producer)
+  {
+    producers.emplace_back([producer] {
+      for (uint32_t sequence = 0; sequence < Records;)
+      {
+        const uint32_t record[] = { producer, sequence, producer ^ sequence };
+        if (ring.write(record, sizeof(record)) == Err::NONE)
+        {
+          ++sequence;
+        }
+        else
+        {
+          // Lets the consumer run, which on a single core is the only way the ring drains
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Each record arrives whole, and each producer's records arrive in order
+  uint32_t next[Producers]{};
+  uint32_t record[3];
+  size_t   filled   = 0;
+  uint32_t received = 0;
+  while (received < (Producers * Records))
+  {
+    const auto taken = ring.read(reinterpret_cast<uint8_t*>(record) + filled, sizeof(record) - filled);
+    filled += taken;
+    if (taken == 0)
+    {
+      std::this_thread::yield();
+    }
+    else if (filled == sizeof(record))
+    {
+      ASSERT_LT(record[0], Producers);
+      ASSERT_EQ(next[record[0]]++, record[1]);
+      ASSERT_EQ(record[0] ^ record[1], record[2]);
+      filled = 0;
+      ++received;
+    }
+  }
+  for (auto& producer : producers)
+  {
+    producer.join();
+  }
+  ASSERT_TRUE(ring.empty());
+}
@@ -0,0 +1,108 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/Calibration.hpp>
+
+using namespace lil;
+
+using Q16_16     = Fixed<16, 16>;
+using AdcToVolts = LinearMap<Interval<uint16_t>, Interval<float>>;
+using AdcToTemp  = LinearMap<Interval<uint16_t>, Interval<Q16_16>>;
+using IntToInt   = LinearMap<Interval<int>, Interval<int>>;
+
+static_assert(IntToInt({ 0, 100 }, { 0, 1000 })(50) == 500, "LinearMap should be usable at compile time");
+static_assert(IntToInt({ 0, 3 }, { 0, 10 })(1) == 3, "Integer LinearMap should round to nearest");
+static_assert(IntToInt({ 0, 3 }, { 0, 10 })(2) == 7, "Integer LinearMap should round to nearest");
+
+TEST(LinearMapTest, MapsFloatingOutput)
+{
+  const AdcToVolts map({ 0, 4095 }, { 0.0F, 3.3F });
+
+  ASSERT_FLOAT_EQ(0.0F, map(0));
+  ASSERT_FLOAT_EQ(3.3F, map(4095));
+  ASSERT_NEAR(1.65F, map(2048), 0.001F);
+}
+
+TEST(LinearMapTest, ClipsInputToInputInterval)
+{
+  const AdcToVolts map({ 100, 200 }, { 0.0F, 1.0F });
+
+  ASSERT_FLOAT_EQ(0.0F, map(0));
+  ASSERT_FLOAT_EQ(1.0F, map(65535));
+}
+
+TEST(LinearMapTest, MapsFixedOutputWithoutFloatingPoint)
+{
+  const AdcToTemp  fixed({ 0, 4095 }, { Q16_16(-40), Q16_16(125) });
+  const AdcToVolts reference({ 0, 4095 }, { -40.0F, 125.0F });
+
+  for (uint16_t adc = 0; adc < 4096; adc += 13)
+  {
+    ASSERT_NEAR(reference(adc), fixed(adc).toFloat(), 0.0001F);
+  }
+}
+
+TEST(LinearMapTest, TwoPointMapMayDescend)
+{
+  const LinearMap<Interval<float>, Interval<float>> map(10.0F, 100.0F, 20.0F, 0.0F);
+  const IntToInt                                    integer(20, 0, 10, 100);
+
+  ASSERT_FLOAT_EQ(50.0F, map(15.0F));
+  ASSERT_FLOAT_EQ(100.0F, map(0.0F));
+  ASSERT_EQ(50, integer(15));
+  ASSERT_EQ(0, integer(30));
+}
+
+TEST(LinearMapTest, BatchMatchesScalar)
+{
+  const AdcToVolts map({ 0, 4095 }, { 0.0F, 3.3F });
+  const uint16_t   adc[] = { 0, 1, 1000, 4095, 4096 };
+  float            volts[5];
+
+  map(adc, volts, 5);
+  for (size_t i = 0; i < 5; ++i)
+  {
+    ASSERT_EQ(map(adc[i]), volts[i]);
+  }
+}
+
+TEST(PiecewiseLinearTest, InterpolatesBetweenBreakpoints)
+{
+  const float                 xs[] = { 0.0F, 10.0F, 20.0F, 30.0F };
+  const float                 ys[] = { 0.0F, 100.0F, 50.0F, 50.0F };
+  const PiecewiseLinear<4>    table(xs, ys);
+
+  ASSERT_EQ(0u, table.segment(-1.0F));
+  ASSERT_EQ(0u, table.segment(9.9F));
+  ASSERT_EQ(1u, table.segment(10.0F));
+  ASSERT_EQ(2u, table.segment(25.0F));
+  ASSERT_EQ(2u, table.segment(99.0F));
+
+  ASSERT_FLOAT_EQ(0.0F, table(-5.0F));
+  ASSERT_FLOAT_EQ(50.0F, table(5.0F));
+  ASSERT_FLOAT_EQ(100.0F, table(10.0F));
+  ASSERT_FLOAT_EQ(75.0F, table(15.0F));
+  ASSERT_FLOAT_EQ(50.0F, table(25.0F));
+  ASSERT_FLOAT_EQ(50.0F, table(35.0F));
+}
+
+TEST(PiecewiseLinearTest, FixedBackendMatchesFloat)
+{
+  const uint16_t xs[]       = { 0, 500, 1500, 4095 };
+  const float    ys[]       = { -40.0F, 0.0F, 60.0F, 125.0F };
+  const Q16_16   fixed_ys[] = { Q16_16(ys[0]), Q16_16(ys[1]), Q16_16(ys[2]), Q16_16(ys[3]) };
+
+  const PiecewiseLinear<4, uint16_t, float>  reference(xs, ys);
+  const PiecewiseLinear<4, uint16_t, Q16_16> fixed(xs, fixed_ys);
+
+  uint16_t adc[64];
+  Q16_16   out[64];
+  for (uint16_t i = 0; i < 64; ++i)
+  {
+    adc[i] = static_cast<uint16_t>(i * 67);
+  }
+  fixed(adc, out, 64);
+  for (size_t i = 0; i < 64; ++i)
+  {
+    ASSERT_NEAR(reference(adc[i]), out[i].toFloat(), 0.0001F);
+  }
+}
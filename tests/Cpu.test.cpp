@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <lil/Cpu.hpp>
+#include <lil/Hash.hpp>
+#include <lil/Utf8.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+/** @brief Calls check(level, variant) for every variant of kernel this CPU can run. */
+template <typename Function, typename Check>
+void forEachVariant(const Kernel<Function>& kernel, Check check)
+{
+  for (size_t level = 0; level <= static_cast<size_t>(cpuDetected()); ++level)
+  {
+    if (kernel.variants[level] != nullptr)
+    {
+      SCOPED_TRACE(cpuLevelName(static_cast<CpuLevel>(level)));
+      check(static_cast<CpuLevel>(level), kernel.variants[level]);
+    }
+  }
+}
+
+/** @brief Random text of every size up to 300 bytes: mostly ASCII, with well-formed and malformed sequences mixed in. */
+std::vector<std::string> texts()
+{
+  const char* pieces[] = { "a",        "0123456789abcdef", "\xC3\xA9",     "\xE2\x82\xAC",     "\xF0\x9F\x98\x80",
+                           "\xC0\xAF", "\xED\xA0\x80",     "\xF4\x90\x80\x80", "\xE0\x80\xAF", "\x80",
+                           "\xE2\x82", "\xFF" };
+  std::mt19937             random(7);
+  std::vector<std::string> texts;
+  for (size_t size = 0; size <= 300; ++size)
+  {
+    std::string text;
+    while (text.size() < size)
+    {
+      // One piece in 64 is malformed, so long texts are often valid too
+      const auto malformed = (random() % 64) == 0;
+      text += pieces[malformed ? (5 + (random() % 7)) : (random() % 5)];
+    }
+    texts.push_back(text.substr(0, size));
+  }
+  return texts;
+}
+}  // namespace
+
+TEST(CpuTest, DetectsALevelAndCapsIt)
+{
+  ASSERT_LE(static_cast<size_t>(cpuDetected()), static_cast<size_t>(CpuLevel::Avx512));
+  ASSERT_LE(static_cast<size_t>(cpuLevel()), static_cast<size_t>(cpuDetected()));
+  ASSERT_LE(static_cast<size_t>(cpuLevel()), static_cast<size_t>(LIL_CPU_LEVEL));
+  ASSERT_STREQ("AVX2", cpuLevelName(CpuLevel::Avx2));
+}
+
+TEST(CpuTest, KernelsFallBackToTheHighestLevelBelow)
+{
+  using Function = int (*)();
+  constexpr Function scalar = [] { return 0; };
+  constexpr Function sse42  = [] { return 1; };
+  constexpr Kernel<Function> kernel{ { scalar, sse42, nullptr, nullptr } };
+
+  ASSERT_EQ(0, kernel.at(CpuLevel::Scalar)());
+  ASSERT_EQ(1, kernel.at(CpuLevel::Sse42)());
+  ASSERT_EQ(1, kernel.at(CpuLevel::Avx512)());
+}
+
+TEST(CpuTest, Crc32cVariantsMatchTheScalarReference)
+{
+  static_assert(crc32c("123456789", 9) == 0xE3069283U);
+  ASSERT_EQ(0xE3069283U, crc32c("123456789", 9));
+  ASSERT_EQ(crc32c("123456789", 9), crc32c("6789", 4, crc32c("12345", 5)));
+
+  const auto reference = detail::Crc32c_Kernel.variants[0];
+  forEachVariant(detail::Crc32c_Kernel, [&](CpuLevel, detail::Crc32cFunction variant) {
+    for (const auto& text : texts())
+    {
+      ASSERT_EQ(reference(text.data(), text.size(), 0), variant(text.data(), text.size(), 0)) << text.size();
+      ASSERT_EQ(reference(text.data(), text.size(), 0x1234), variant(text.data(), text.size(), 0x1234));
+    }
+  });
+}
+
+TEST(CpuTest, Utf8ValidVariantsMatchTheScalarReference)
+{
+  ASSERT_TRUE(utf8Valid("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", 14));
+  ASSERT_FALSE(utf8Valid("\xC0\xAF", 2));          // Overlong '/'
+  ASSERT_FALSE(utf8Valid("\xED\xA0\x80", 3));      // Surrogate
+  ASSERT_FALSE(utf8Valid("\xF4\x90\x80\x80", 4));  // Above U+10FFFF
+  ASSERT_FALSE(utf8Valid("\xE2\x82", 2));          // Truncated
+
+  const auto reference = detail::Utf8_Valid_Kernel.variants[0];
+  size_t     valid     = 0;
+  for (const auto& text : texts())
+  {
+    valid += reference(text.data(), text.size()) ? 1 : 0;
+  }
+  ASSERT_GT(valid, texts().size() / 4);
+
+  forEachVariant(detail::Utf8_Valid_Kernel, [&](CpuLevel, detail::Utf8ValidFunction variant) {
+    for (const auto& text : texts())
+    {
+      ASSERT_EQ(reference(text.data(), text.size()), variant(text.data(), text.size())) << text.size();
+    }
+  });
+}
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+#include <lil/Err.hpp>
+
+using namespace lil;
+
+TEST(ErrTest, ToStringNamesEveryCode)
+{
+  ASSERT_STREQ("NONE", ToString(NONE));
+  ASSERT_STREQ("BAD_ALLOC", ToString(BAD_ALLOC));
+  ASSERT_STREQ("KEY_EXPIRED", ToString(KEY_EXPIRED));
+  for (int err = NONE; err < METL_MAX; ++err)
+  {
+    ASSERT_STRNE("", ToString(static_cast<Err>(err)));
+    ASSERT_STRNE("INVALID", ToString(static_cast<Err>(err)));
+  }
+}
+
+TEST(ErrTest, ToStringHandlesUnassignedCodes)
+{
+  ASSERT_STREQ("USER_ERROR", ToString(USER_ERROR));
+  ASSERT_STREQ("USER_ERROR", ToString(static_cast<Err>(USER_ERROR + 7)));
+  ASSERT_STREQ("INVALID", ToString(METL_MAX));
+  ASSERT_STREQ("INVALID", ToString(ERROR_MAX));
+}
+
+TEST(ErrTest, DescribeExplainsCode)
+{
+  ASSERT_STREQ("Illegal division by zero.", Describe(DIVIDE_BY_ZERO));
+  ASSERT_STREQ("Application specific error.", Describe(static_cast<Err>(USER_ERROR + 1)));
+}
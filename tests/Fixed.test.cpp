@@ -0,0 +1,134 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/Fixed.hpp>
+#include <lil/IntervalSet.hpp>
+#include <type_traits>
+
+using namespace lil;
+
+using Q8_8   = Fixed<8, 8>;
+using Q16_16 = Fixed<16, 16>;
+
+static_assert(std::is_same<int16_t, Q8_8::raw_type>::value, "Fixed storage should come from BitsToInt_t");
+static_assert(std::is_same<int16_t, Fixed<4, 8>::raw_type>::value, "Fixed storage should come from BitsToInt_t");
+static_assert(std::is_same<int32_t, Q16_16::raw_type>::value, "Fixed storage should come from BitsToInt_t");
+static_assert(std::is_trivially_copyable<Q16_16>::value, "Fixed should be passed around like an integer");
+static_assert(Q8_8(1.5F) + Q8_8(2) == Q8_8(3.5), "Fixed arithmetic should be usable at compile time");
+
+TEST(FixedTest, ConvertsToAndFromNumbers)
+{
+  ASSERT_EQ(0x0180, Q8_8(1.5F).raw());
+  ASSERT_EQ(-0x0180, Q8_8(-1.5).raw());
+  ASSERT_EQ(0x0300, Q8_8(3).raw());
+  ASSERT_FLOAT_EQ(1.5F, Q8_8(1.5F).toFloat());
+  ASSERT_EQ(-2, Q8_8(-1.5F).toInt());
+  ASSERT_EQ(1, Q8_8(1.99F).toInt());
+}
+
+TEST(FixedTest, ConversionSaturates)
+{
+  ASSERT_EQ(Q8_8::max(), Q8_8(1000));
+  ASSERT_EQ(Q8_8::lowest(), Q8_8(-1000));
+  ASSERT_EQ(Q8_8::max(), Q8_8(1000.0F));
+  ASSERT_EQ(Q8_8::lowest(), Q8_8(-1000.0F));
+  ASSERT_EQ(Q8_8::max(), Q8_8(1000u));
+
+  // Fixed<4, 8> only uses 12 of its 16 storage bits.
+  ASSERT_EQ(0x07FF, (Fixed<4, 8>(100).raw()));
+}
+
+TEST(FixedTest, ArithmeticIsExactWithinRange)
+{
+  Err err = Err::NONE;
+  ASSERT_EQ(Q16_16(4.25), Q16_16(1.5).add(Q16_16(2.75), err));
+  ASSERT_EQ(Q16_16(-1.25), Q16_16(1.5).subtract(Q16_16(2.75), err));
+  ASSERT_EQ(Q16_16(-3.75), Q16_16(1.5).multiply(Q16_16(-2.5), err));
+  ASSERT_EQ(Q16_16(0.375), Q16_16(1.5).divide(Q16_16(4), err));
+  ASSERT_EQ(Err::NONE, err);
+}
+
+TEST(FixedTest, OverflowSaturatesAndReportsError)
+{
+  Err err = Err::NONE;
+  ASSERT_EQ(Q8_8::max(), Q8_8(100).add(Q8_8(100), err));
+  ASSERT_EQ(Err::MATH_OVERFLOW, err);
+
+  err = Err::NONE;
+  ASSERT_EQ(Q8_8::lowest(), Q8_8(-100).subtract(Q8_8(100), err));
+  ASSERT_EQ(Err::MATH_OVERFLOW, err);
+
+  err = Err::NONE;
+  ASSERT_EQ(Q8_8::lowest(), Q8_8(-20).multiply(Q8_8(20), err));
+  ASSERT_EQ(Err::MATH_OVERFLOW, err);
+
+  err = Err::NONE;
+  ASSERT_EQ(Q8_8::max(), Q8_8(100).divide(Q8_8(0.25), err));
+  ASSERT_EQ(Err::MATH_OVERFLOW, err);
+
+  ASSERT_EQ(Q8_8::max(), -Q8_8::lowest());
+}
+
+TEST(FixedTest, DivideByZeroSaturatesTowardSign)
+{
+  Err err = Err::NONE;
+  ASSERT_EQ(Q8_8::max(), Q8_8(1).divide(Q8_8(), err));
+  ASSERT_EQ(Err::DIVIDE_BY_ZERO, err);
+  ASSERT_EQ(Q8_8::lowest(), Q8_8(-1) / Q8_8());
+  ASSERT_EQ(Q8_8(), Q8_8() / 0);
+}
+
+TEST(FixedTest, WorksAsIntervalValue)
+{
+  const Interval<Q8_8> range{ Q8_8(10), Q8_8(-2) };
+
+  ASSERT_EQ(Q8_8(-2), range.min);
+  ASSERT_EQ(Q8_8(4), range.mid());
+  ASSERT_EQ(Q8_8(12), range.length());
+  ASSERT_EQ(Q8_8(10), range.clip(Q8_8(50)));
+  ASSERT_TRUE(range.inRange(Q8_8(0.5)));
+  ASSERT_EQ(Q8_8(4), range.deadband(Q8_8(1)));
+  ASSERT_EQ(Q8_8(11), range.deadband(Q8_8(11)));
+
+  // Bounds that sum past max() or lowest() still have their midpoint inside
+  const Interval<Q8_8> high{ Q8_8(100), Q8_8(120) };
+  const Interval<Q8_8> low{ Q8_8(-120), Q8_8(-100) };
+  const Interval<Q8_8> full{ Q8_8::lowest(), Q8_8::max() };
+  ASSERT_EQ(Q8_8(110), high.mid());
+  ASSERT_EQ(Q8_8(110), high.deadband(Q8_8(101)));
+  ASSERT_EQ(Q8_8(-110), low.mid());
+  ASSERT_TRUE(full.inRange(full.mid()));
+  ASSERT_EQ(Interval<int8_t>(-128, 127).mid(), int8_t((-128 + 127) / 2));
+  ASSERT_EQ(Interval<int>(-3, -2).mid(), (-3 + -2) / 2);
+
+  IntervalSet<Q8_8, 4> set;
+  set.insert({ Q8_8(0), Q8_8(1) });
+  set.insert({ IntervalStep<Q8_8>::next(Q8_8(1)), Q8_8(2) });
+  ASSERT_EQ(1u, set.size());
+}
+
+TEST(FixedTest, BatchArithmeticMatchesScalar)
+{
+  const Q8_8 lhs[] = { Q8_8(1), Q8_8(100), Q8_8(-100), Q8_8(0.5), Q8_8(-3) };
+  const Q8_8 rhs[] = { Q8_8(2), Q8_8(100), Q8_8(100), Q8_8(0.25), Q8_8(7) };
+  Q8_8       out[5];
+
+  ASSERT_EQ(Err::MATH_OVERFLOW, add(lhs, rhs, out, 5));
+  for (size_t i = 0; i < 5; ++i)
+  {
+    ASSERT_EQ(lhs[i] + rhs[i], out[i]);
+  }
+
+  ASSERT_EQ(Err::MATH_OVERFLOW, subtract(lhs, rhs, out, 5));
+  for (size_t i = 0; i < 5; ++i)
+  {
+    ASSERT_EQ(lhs[i] - rhs[i], out[i]);
+  }
+
+  ASSERT_EQ(Err::MATH_OVERFLOW, multiply(lhs, rhs, out, 5));
+  for (size_t i = 0; i < 5; ++i)
+  {
+    ASSERT_EQ(lhs[i] * rhs[i], out[i]);
+  }
+
+  ASSERT_EQ(Err::NONE, add(lhs, rhs, out, 1));
+}
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/FixedPriorityQueue.hpp>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+namespace {
+template <typename TQueue>
+std::vector<int> drain(TQueue& queue)
+{
+  std::vector<int> values;
+  while (!queue.empty())
+  {
+    values.push_back(queue.top());
+    queue.pop();
+  }
+  return values;
+}
+}  // namespace
+
+TEST(FixedPriorityQueueTest, PopsInPriorityOrder)
+{
+  FixedPriorityQueue<int, 8>                              maxQueue;
+  FixedPriorityQueue<int, 8, std::greater<int>, 2, false> minQueue;
+  for (int value : { 5, 1, 7, 3, 7, 2 })
+  {
+    ASSERT_TRUE(maxQueue.push(value).ok());
+    ASSERT_EQ(NONE, minQueue.push(value));
+  }
+  ASSERT_THAT(drain(maxQueue), ElementsAre(7, 7, 5, 3, 2, 1));
+  ASSERT_THAT(drain(minQueue), ElementsAre(1, 2, 3, 5, 7, 7));
+  ASSERT_EQ(RESOURCE_EMPTY, maxQueue.pop());
+}
+
+TEST(FixedPriorityQueueTest, RejectsPushWhenFull)
+{
+  FixedPriorityQueue<int, 3> queue;
+  for (int value : { 1, 2, 3 })
+  {
+    ASSERT_TRUE(queue.push(value).ok());
+  }
+  ASSERT_EQ(RESOURCE_FULL, queue.push(4).err());
+  queue.pop();
+  ASSERT_TRUE(queue.push(4).ok());
+  ASSERT_EQ(4, queue.top());
+}
+
+TEST(FixedPriorityQueueTest, HandlesUpdateAndEraseElements)
+{
+  FixedPriorityQueue<int, 8, std::greater<int>> deadlines;
+  const auto                                    a = *deadlines.push(30);
+  const auto                                    b = *deadlines.push(20);
+  const auto                                    c = *deadlines.push(10);
+
+  ASSERT_EQ(c, deadlines.topHandle());
+  ASSERT_EQ(NONE, deadlines.update(a, 5));
+  ASSERT_EQ(a, deadlines.topHandle());
+  ASSERT_EQ(NONE, deadlines.update(a, 25));
+  ASSERT_EQ(25, *deadlines.find(a));
+  ASSERT_EQ(NONE, deadlines.erase(c));
+  ASSERT_FALSE(deadlines.contains(c));
+  ASSERT_EQ(INVALID_ARGUMENT, deadlines.erase(c));
+  ASSERT_EQ(INVALID_ARGUMENT, deadlines.update(c, 1));
+  ASSERT_EQ(INVALID_ARGUMENT, deadlines.find(c).err());
+
+  // The erased slot is reused under a new generation
+  const auto d = *deadlines.push(40);
+  ASSERT_EQ(c.slot, d.slot);
+  ASSERT_FALSE(deadlines.contains(c));
+  ASSERT_THAT(drain(deadlines), ElementsAre(20, 25, 40));
+  ASSERT_FALSE(deadlines.contains(b));
+}
+
+template <size_t D>
+void matchesReference(uint32_t seed)
+{
+  FixedPriorityQueue<int, 256, std::less<int>, D> queue;
+  std::multimap<int, HeapHandle, std::greater<int>> reference;
+  std::mt19937                                    random(seed);
+  for (int step = 0; step < 20000; ++step)
+  {
+    const auto operation = random() % 4;
+    if ((operation == 0) && !reference.empty())
+    {
+      ASSERT_EQ(reference.begin()->first, queue.top());
+      queue.pop();
+      reference.erase(std::find_if(reference.begin(), reference.end(), [&](const auto& entry) {
+        return (entry.first == reference.begin()->first) && !queue.contains(entry.second);
+      }));
+    }
+    else if ((operation == 1) && !reference.empty())
+    {
+      auto entry = std::next(reference.begin(), static_cast<long>(random() % reference.size()));
+      const auto value = static_cast<int>(random() % 1000);
+      ASSERT_EQ(NONE, queue.update(entry->second, value));
+      const auto handle = entry->second;
+      reference.erase(entry);
+      reference.emplace(value, handle);
+    }
+    else if ((operation == 2) && !reference.empty())
+    {
+      auto entry = std::next(reference.begin(), static_cast<long>(random() % reference.size()));
+      ASSERT_EQ(NONE, queue.erase(entry->second));
+      reference.erase(entry);
+    }
+    else if (reference.size() < 256)
+    {
+      const auto value = static_cast<int>(random() % 1000);
+      reference.emplace(value, *queue.push(value));
+    }
+    ASSERT_EQ(reference.size(), queue.size());
+    if (!reference.empty())
+    {
+      ASSERT_EQ(reference.begin()->first, queue.top());
+    }
+  }
+}
+
+TEST(FixedPriorityQueueTest, MatchesReferenceForEachArity)
+{
+  matchesReference<2>(1);
+  matchesReference<3>(2);
+  matchesReference<4>(3);
+  matchesReference<8>(4);
+}
@@ -0,0 +1,143 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/IntervalSet.hpp>
+
+using testing::ElementsAre;
+using namespace lil;
+
+using Range = Interval<int>;
+using Set4  = IntervalSet<int, 4>;
+using Set1  = IntervalSet<int, 1>;
+
+TEST(IntervalSetTest, InsertKeepsIntervalsSortedAndDisjoint)
+{
+  IntervalSet<int, 4> set;
+
+  ASSERT_EQ(Err::NONE, set.insert({ 20, 30 }));
+  ASSERT_EQ(Err::NONE, set.insert({ 0, 5 }));
+  ASSERT_EQ(Err::NONE, set.insert({ 10, 12 }));
+
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 5 }, Range{ 10, 12 }, Range{ 20, 30 }));
+}
+
+TEST(IntervalSetTest, InsertCoalescesOverlappingAndAdjacentIntervals)
+{
+  IntervalSet<int, 4> set;
+  set.insert({ 0, 5 });
+  set.insert({ 10, 12 });
+  set.insert({ 20, 30 });
+
+  // [6, 9] touches both neighbours, so all three collapse into one.
+  ASSERT_EQ(Err::NONE, set.insert({ 6, 9 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 12 }, Range{ 20, 30 }));
+
+  ASSERT_EQ(Err::NONE, set.insert({ 25, 40 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 12 }, Range{ 20, 40 }));
+
+  ASSERT_EQ(Err::NONE, set.insert({ -10, 50 }));
+  ASSERT_THAT(set, ElementsAre(Range{ -10, 50 }));
+}
+
+TEST(IntervalSetTest, InsertIntoFullSetFailsWithoutModification)
+{
+  IntervalSet<int, 2> set;
+  set.insert({ 0, 1 });
+  set.insert({ 10, 11 });
+
+  ASSERT_EQ(Err::RESOURCE_FULL, set.insert({ 5, 6 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 1 }, Range{ 10, 11 }));
+
+  // Merging does not need a new slot, so it still succeeds.
+  ASSERT_EQ(Err::NONE, set.insert({ 2, 9 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 11 }));
+}
+
+TEST(IntervalSetTest, ContainsUsesInclusiveBoundaries)
+{
+  IntervalSet<int, 4> set;
+  set.insert({ 0, 5 });
+  set.insert({ 10, 12 });
+
+  ASSERT_FALSE(set.contains(-1));
+  ASSERT_TRUE(set.contains(0));
+  ASSERT_TRUE(set.contains(5));
+  ASSERT_FALSE(set.contains(6));
+  ASSERT_TRUE(set.contains(12));
+  ASSERT_FALSE(set.contains(13));
+
+  ASSERT_TRUE(set.contains(Range{ 1, 4 }));
+  ASSERT_FALSE(set.contains(Range{ 4, 10 }));
+  ASSERT_TRUE(set.overlaps(Range{ 4, 10 }));
+  ASSERT_FALSE(set.overlaps(Range{ 6, 9 }));
+}
+
+TEST(IntervalSetTest, EraseSplitsAndTrimsIntervals)
+{
+  IntervalSet<int, 4> set;
+  set.insert({ 0, 20 });
+
+  ASSERT_EQ(Err::NONE, set.erase({ 5, 9 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 4 }, Range{ 10, 20 }));
+
+  ASSERT_EQ(Err::NONE, set.erase({ 3, 12 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 2 }, Range{ 13, 20 }));
+
+  ASSERT_EQ(Err::NONE, set.erase({ 0, 2 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 13, 20 }));
+
+  ASSERT_EQ(Err::NONE, set.erase({ 100, 200 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 13, 20 }));
+}
+
+TEST(IntervalSetTest, EraseSplitInFullSetFailsWithoutModification)
+{
+  IntervalSet<int, 1> set;
+  set.insert({ 0, 20 });
+
+  ASSERT_EQ(Err::RESOURCE_FULL, set.erase({ 5, 9 }));
+  ASSERT_THAT(set, ElementsAre(Range{ 0, 20 }));
+}
+
+TEST(IntervalSetTest, SetOperations)
+{
+  IntervalSet<int, 4> lhs;
+  lhs.insert({ 0, 10 });
+  lhs.insert({ 20, 30 });
+  IntervalSet<int, 4> rhs;
+  rhs.insert({ 5, 22 });
+  rhs.insert({ 28, 40 });
+
+  IntervalSet<int, 4> out;
+  ASSERT_EQ(Err::NONE, Set4::uunion(lhs, rhs, out));
+  ASSERT_THAT(out, ElementsAre(Range{ 0, 40 }));
+
+  ASSERT_EQ(Err::NONE, Set4::intersect(lhs, rhs, out));
+  ASSERT_THAT(out, ElementsAre(Range{ 5, 10 }, Range{ 20, 22 }, Range{ 28, 30 }));
+
+  ASSERT_EQ(Err::NONE, Set4::difference(lhs, rhs, out));
+  ASSERT_THAT(out, ElementsAre(Range{ 0, 4 }, Range{ 23, 27 }));
+
+  ASSERT_EQ(Err::NONE, Set4::difference(rhs, lhs, out));
+  ASSERT_THAT(out, ElementsAre(Range{ 11, 19 }, Range{ 31, 40 }));
+
+  IntervalSet<int, 1> small;
+  ASSERT_EQ(Err::RESOURCE_FULL, Set1::intersect(lhs, rhs, small));
+  ASSERT_THAT(small, ElementsAre(Range{ 5, 10 }));
+}
+
+TEST(IntervalSetTest, FloatingPointIntervalsOnlyCoalesceWhenTouching)
+{
+  IntervalSet<float, 4> set;
+  set.insert({ 0.0F, 1.0F });
+  set.insert({ 2.0F, 3.0F });
+  ASSERT_EQ(2u, set.size());
+
+  set.erase({ 0.5F, 0.5F });
+  ASSERT_EQ(3u, set.size());
+  ASSERT_TRUE(set.contains(0.4999F));
+  ASSERT_FALSE(set.contains(0.5F));
+  ASSERT_TRUE(set.contains(0.5001F));
+
+  set.insert({ 0.5F, 0.5F });
+  ASSERT_THAT(set, ElementsAre(Interval<float>{ 0.0F, 1.0F }, Interval<float>{ 2.0F, 3.0F }));
+}
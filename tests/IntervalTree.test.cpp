@@ -0,0 +1,82 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/IntervalTree.hpp>
+#include <vector>
+
+using testing::UnorderedElementsAre;
+using testing::UnorderedElementsAreArray;
+using namespace lil;
+
+namespace {
+template <typename TTree, typename T>
+std::vector<size_t> stab(const TTree& tree, T value)
+{
+  std::vector<size_t> ids;
+  tree.stab(value, [&](size_t id, const Interval<T>&) { ids.push_back(id); });
+  return ids;
+}
+}  // namespace
+
+TEST(IntervalTreeTest, StabFindsEveryContainingInterval)
+{
+  const Interval<int> intervals[] = { { 0, 10 }, { 5, 6 }, { 8, 20 }, { 15, 15 }, { -5, 0 } };
+  IntervalTree<int, 8> tree;
+  ASSERT_EQ(Err::NONE, tree.build(intervals, 5));
+
+  ASSERT_THAT(stab(tree, 0), UnorderedElementsAre(0u, 4u));
+  ASSERT_THAT(stab(tree, 5), UnorderedElementsAre(0u, 1u));
+  ASSERT_THAT(stab(tree, 9), UnorderedElementsAre(0u, 2u));
+  ASSERT_THAT(stab(tree, 15), UnorderedElementsAre(2u, 3u));
+  ASSERT_THAT(stab(tree, 21), UnorderedElementsAre());
+  ASSERT_THAT(stab(tree, -6), UnorderedElementsAre());
+}
+
+TEST(IntervalTreeTest, OverlappingFindsEveryIntersectingInterval)
+{
+  const Interval<int> intervals[] = { { 0, 10 }, { 5, 6 }, { 8, 20 }, { 15, 15 }, { -5, 0 } };
+  IntervalTree<int, 8> tree;
+  tree.build(intervals, 5);
+
+  std::vector<size_t> ids;
+  ASSERT_EQ(2u, tree.overlapping({ 11, 16 }, [&](size_t id, const Interval<int>&) { ids.push_back(id); }));
+  ASSERT_THAT(ids, UnorderedElementsAre(2u, 3u));
+}
+
+TEST(IntervalTreeTest, BuildBeyondCapacityFails)
+{
+  const Interval<int> intervals[] = { { 0, 1 }, { 2, 3 }, { 4, 5 } };
+  IntervalTree<int, 2> tree;
+
+  ASSERT_EQ(Err::RESOURCE_FULL, tree.build(intervals, 3));
+  ASSERT_TRUE(tree.empty());
+}
+
+TEST(IntervalTreeTest, MatchesLinearScan)
+{
+  constexpr size_t             count = 1000;
+  static IntervalTree<int, count> tree;
+  std::vector<Interval<int>>   intervals;
+  unsigned                     seed = 12345;
+  for (size_t i = 0; i < count; ++i)
+  {
+    seed           = (seed * 1103515245u) + 12345u;
+    const int min  = static_cast<int>(seed % 10000);
+    seed           = (seed * 1103515245u) + 12345u;
+    const int span = static_cast<int>(seed % 200);
+    intervals.emplace_back(min, min + span);
+  }
+  ASSERT_EQ(Err::NONE, tree.build(intervals.data(), intervals.size()));
+
+  for (int value = -10; value < 10300; value += 7)
+  {
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < intervals.size(); ++i)
+    {
+      if (intervals[i].inRange(value))
+      {
+        expected.push_back(i);
+      }
+    }
+    ASSERT_THAT(stab(tree, value), UnorderedElementsAreArray(expected));
+  }
+}
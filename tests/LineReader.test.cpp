@@ -0,0 +1,139 @@
+#include <fstream>
+#include <gtest/gtest.h>
+#include <lil/LineReader.hpp>
+#include <lil/Str.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+std::string writeFile(const std::string& name, const std::string& contents)
+{
+  const auto    path = testing::TempDir() + name;
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file << contents;
+  return path;
+}
+
+std::vector<std::string> readAll(LineReader& reader)
+{
+  std::vector<std::string> records;
+  while (const auto record = reader.next())
+  {
+    records.emplace_back(*record);
+  }
+  return records;
+}
+
+/** @brief Lines of 0 to 299 characters, so that records straddle every few blocks. */
+std::string manyLines(char delimiter)
+{
+  std::string text;
+  for (size_t line = 0; line < 2000; ++line)
+  {
+    text.append((line * 37) % 300, static_cast<char>('a' + (line % 26)));
+    text.push_back(delimiter);
+  }
+  return text;
+}
+}  // namespace
+
+TEST(LineReaderTest, ReadsRecordsOfAMappedFile)
+{
+  const auto path = writeFile("lil_line_reader_mapped", "a\n\nbc\nlast");
+  LineReader reader;
+
+  ASSERT_EQ(NONE, reader.open(path.c_str()));
+  ASSERT_TRUE(reader.mapped());
+  ASSERT_EQ((std::vector<std::string>{ "a", "", "bc", "last" }), readAll(reader));
+  ASSERT_EQ(RESOURCE_EMPTY, reader.next().err());
+}
+
+TEST(LineReaderTest, ReadingGivesTheSameRecordsAsMapping)
+{
+  for (const char delimiter : { '\n', ';' })
+  {
+    const auto path = writeFile("lil_line_reader_blocks", manyLines(delimiter) + "unterminated");
+    LineReader mapped;
+    LineReader read;
+
+    ASSERT_EQ(NONE, mapped.open(path.c_str(), delimiter));
+    ASSERT_EQ(NONE, read.open(path.c_str(), delimiter, LineReader::Mode::Read, 4096));
+    ASSERT_FALSE(read.mapped());
+
+    const auto expected = readAll(mapped);
+    ASSERT_EQ(2001U, expected.size());
+    ASSERT_EQ("unterminated", expected.back());
+    ASSERT_EQ(expected, readAll(read));
+  }
+}
+
+TEST(LineReaderTest, ReadingTruncatesRecordsLongerThanTheBlock)
+{
+  const auto path = writeFile("lil_line_reader_long", "short\n" + std::string(10000, 'x') + "\nafter\n");
+  LineReader reader;
+
+  ASSERT_EQ(NONE, reader.open(path.c_str(), '\n', LineReader::Mode::Read, 4096));
+  const auto records = readAll(reader);
+  ASSERT_EQ(3U, records.size());
+  ASSERT_EQ(std::string(4096, 'x'), records[1]);
+  ASSERT_EQ("after", records[2]);
+}
+
+TEST(LineReaderTest, FillsStrTruncating)
+{
+  const auto path = writeFile("lil_line_reader_str", "imu/raw\nsensor/temperature\n");
+  LineReader reader;
+  Str<8>     topic;
+
+  ASSERT_EQ(NONE, reader.open(path.c_str()));
+  ASSERT_EQ(NONE, reader.next(topic));
+  ASSERT_STREQ("imu/raw", topic.c_str());
+  ASSERT_EQ(NONE, reader.next(topic));
+  ASSERT_STREQ("sensor/", topic.c_str());
+  ASSERT_EQ(RESOURCE_EMPTY, reader.next(topic));
+}
+
+TEST(LineReaderTest, SplitsAtRecordBoundaries)
+{
+  const auto text = manyLines('\n');
+  const auto path = writeFile("lil_line_reader_split", text);
+  LineReader reader;
+
+  ASSERT_EQ(NONE, reader.open(path.c_str()));
+  ASSERT_TRUE(reader.next());
+
+  std::string_view chunks[7];
+  const auto       count = reader.split(chunks, 7);
+  ASSERT_EQ(7U, count);
+
+  std::string joined;
+  size_t      records = 0;
+  for (size_t chunk = 0; chunk < count; ++chunk)
+  {
+    ASSERT_EQ('\n', chunks[chunk].back());
+    joined.append(chunks[chunk]);
+    Records walk(chunks[chunk]);
+    while (walk.next())
+    {
+      ++records;
+    }
+  }
+  ASSERT_EQ(text.substr(text.find('\n') + 1), joined);
+  ASSERT_EQ(1999U, records);
+  ASSERT_EQ(RESOURCE_EMPTY, reader.next().err());
+}
+
+TEST(LineReaderTest, ReportsMissingAndEmptyFiles)
+{
+  LineReader reader;
+
+  ASSERT_EQ(INVALID_ARGUMENT, reader.open((testing::TempDir() + "lil_line_reader_missing").c_str()));
+  ASSERT_EQ(NONE, reader.open(writeFile("lil_line_reader_empty", "").c_str()));
+  ASSERT_EQ(RESOURCE_EMPTY, reader.next().err());
+
+  std::string_view chunk;
+  ASSERT_EQ(0U, reader.split(&chunk, 1));
+}
@@ -0,0 +1,140 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <lil/Log.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+static_assert(fnv1a("", 0) == Fnv1a_Basis, "FNV-1a of nothing is the offset basis");
+static_assert(fnv1a("a", 1) == 0xE40C292CU, "FNV-1a should match the reference vectors");
+static_assert(fnv1a("foobar", 6) == 0xBF9CF968U, "FNV-1a should match the reference vectors");
+
+namespace {
+enum class Mode : uint8_t
+{
+  Idle = 3,
+};
+
+std::vector<uint8_t> drain()
+{
+  std::vector<uint8_t> bytes(logBuffer().size());
+  logBuffer().read(bytes.data(), bytes.size());
+  return bytes;
+}
+
+template <typename T>
+T field(const std::vector<uint8_t>& bytes, size_t offset)
+{
+  T value;
+  memcpy(&value, &bytes.at(offset), sizeof(value));
+  return value;
+}
+}  // namespace
+
+#if LIL_LOG_ENABLED
+TEST(LogTest, RecordIsIdFollowedByPromotedArguments)
+{
+  drain();
+  const short  small = -2;
+  const float  ratio = 0.5F;
+  const size_t count = 7;
+
+  const auto line = __LINE__ + 1;
+  LIL_LOG("small=%hd ratio=%f count=%zu mode=%d", small, ratio, count, static_cast<int>(Mode::Idle));
+  const auto bytes = drain();
+
+  const auto entry = std::string(LIL_LOG_MAGIC __FILE__ ":") + std::to_string(line) + '\0' +
+                     "small=%hd ratio=%f count=%zu mode=%d";
+  ASSERT_EQ(sizeof(uint32_t) + sizeof(int) + sizeof(double) + sizeof(size_t) + sizeof(int), bytes.size());
+  ASSERT_EQ(fnv1a(entry.data(), entry.size()), field<uint32_t>(bytes, 0));
+  ASSERT_EQ(-2, field<int>(bytes, 4));
+  ASSERT_EQ(0.5, field<double>(bytes, 8));
+  ASSERT_EQ(7U, field<size_t>(bytes, 16));
+  ASSERT_EQ(3, field<int>(bytes, 16 + sizeof(size_t)));
+}
+
+TEST(LogTest, CallSitesHaveDistinctIds)
+{
+  drain();
+  LIL_LOG("tick");
+  LIL_LOG("tick");
+  const auto bytes = drain();
+
+  ASSERT_EQ(8U, bytes.size());
+  ASSERT_NE(field<uint32_t>(bytes, 0), field<uint32_t>(bytes, 4));
+}
+
+TEST(LogTest, ReportsDroppedRecords)
+{
+  drain();
+  const auto before = logDropped();
+  for (size_t i = 0; i < ((logBuffer().capacity() / 8) + 2); ++i)
+  {
+    LIL_LOG("fill %u", 0U);
+  }
+  ASSERT_EQ(before + 2, logDropped());
+
+  drain();
+  LIL_LOG("after");
+  const auto bytes = drain();
+
+  ASSERT_EQ(12U, bytes.size());
+  ASSERT_EQ(detail::Log_Dropped_Id, field<uint32_t>(bytes, 0));
+  ASSERT_EQ(2U, field<uint32_t>(bytes, 4));
+}
+
+TEST(LogTest, ThreadsLogWholeRecordsConcurrently)
+{
+  constexpr unsigned Threads = 4;
+  constexpr unsigned Records = 5000;
+
+  drain();
+  const auto               before = logDropped();
+  std::atomic<unsigned>    running{ Threads };
+  std::vector<std::thread> threads;
+  for (unsigned thread = 0; thread < Threads; ++thread)
+  {
+    threads.emplace_back([thread, &running] {
+      for (unsigned i = 0; i < Records; ++i)
+      {
+        LIL_LOG("thread %u record %u", thread, i);
+      }
+      running.fetch_sub(1);
+    });
+  }
+  std::vector<uint8_t> bytes;
+  while ((running.load() > 0) || !logBuffer().empty())
+  {
+    const auto drained = drain();
+    bytes.insert(bytes.end(), drained.begin(), drained.end());
+    if (drained.empty())
+    {
+      std::this_thread::yield();
+    }
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  // Only whole records are ever published, so the stream parses from start to end
+  size_t logged = 0;
+  for (size_t offset = 0; offset < bytes.size();)
+  {
+    if (field<uint32_t>(bytes, offset) == detail::Log_Dropped_Id)
+    {
+      offset += 2 * sizeof(uint32_t);
+      continue;
+    }
+    ASSERT_LT(field<unsigned>(bytes, offset + 4), Threads);
+    ASSERT_LT(field<unsigned>(bytes, offset + 8), Records);
+    offset += 3 * sizeof(uint32_t);
+    ++logged;
+  }
+  ASSERT_EQ(Threads * Records, logged + (logDropped() - before));
+}
+#endif
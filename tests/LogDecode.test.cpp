@@ -0,0 +1,105 @@
+#include <elf.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <lil/Log.hpp>
+#include <lil/Telemetry.hpp>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace lil;
+
+// Links with LogDecode.ld, so the log and assert entries sit in a non-allocated section as they would in firmware
+namespace {
+std::vector<char> readFile(const std::string& path)
+{
+  std::ifstream     file(path, std::ios::binary | std::ios::ate);
+  std::vector<char> data(static_cast<size_t>(file.tellg()));
+  file.seekg(0).read(data.data(), static_cast<std::streamsize>(data.size()));
+  return data;
+}
+
+/** @brief Returns the header of the section named name in this test's own ELF, or one of type SHT_NULL. */
+Elf64_Shdr section(const char* name)
+{
+  const auto elf = readFile("/proc/self/exe");
+  Elf64_Ehdr header;
+  memcpy(&header, elf.data(), sizeof(header));
+  Elf64_Shdr names;
+  memcpy(&names, &elf[header.e_shoff + (header.e_shstrndx * header.e_shentsize)], sizeof(names));
+  for (size_t index = 0; index < header.e_shnum; ++index)
+  {
+    Elf64_Shdr candidate;
+    memcpy(&candidate, &elf[header.e_shoff + (index * header.e_shentsize)], sizeof(candidate));
+    if (strcmp(&elf[names.sh_offset + candidate.sh_name], name) == 0)
+    {
+      return candidate;
+    }
+  }
+  return {};
+}
+
+/** @brief Runs lil_log_decode.py with options on this test's ELF and input. @return Its output. */
+std::string decode(const std::vector<uint8_t>& input, const char* options = "")
+{
+  const auto path = testing::TempDir() + "LogDecode.test.bin";
+  std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(input.data()), input.size());
+
+  char elf[4096] = {};
+  EXPECT_LT(0, readlink("/proc/self/exe", elf, sizeof(elf) - 1));
+  const auto  command = std::string(LIL_PYTHON " " LIL_LOG_DECODE " ") + options + elf + " " + path;
+  auto*       pipe    = popen(command.c_str(), "r");
+  std::string out;
+  char        buffer[256];
+  for (size_t count; (count = fread(buffer, 1, sizeof(buffer), pipe)) > 0;)
+  {
+    out.append(buffer, count);
+  }
+  EXPECT_EQ(0, pclose(pipe)) << command;
+  return out;
+}
+}  // namespace
+
+void lil::AssertFail(Err, uint32_t) {}
+
+TEST(LogDecodeTest, EntriesSitInNonAllocatedSection)
+{
+  const auto entries = section("lil_log");
+  ASSERT_EQ(SHT_PROGBITS, entries.sh_type);
+  ASSERT_EQ(0U, entries.sh_flags & SHF_ALLOC);
+  ASSERT_NE(0U, entries.sh_size);
+}
+
+TEST(LogDecodeTest, DecodesAssertSites)
+{
+  const auto line = __LINE__ + 3;
+  for (int i = 0; i < 2; ++i)
+  {
+    LIL_ASSERT(i < 0, INVALID_ARGUMENT);
+  }
+  std::vector<uint8_t> asserts(64);
+  asserts.resize(serializeAsserts(asserts.data(), asserts.size()).value_or(0));
+
+  ASSERT_EQ(std::string(LIL_FILENAME ":") + std::to_string(line) + ": i < 0 failed 2 times\n",
+            decode(asserts, "--asserts "));
+}
+
+#if LIL_LOG_ENABLED
+TEST(LogDecodeTest, DecodesLogRecords)
+{
+  std::vector<uint8_t> log(logBuffer().size());
+  logBuffer().read(log.data(), log.size());
+  const auto line = __LINE__ + 1;
+  LIL_LOG("pump %d at %.2f bar", 3, 1.5);
+  LIL_LOG("valve %s", "open");
+  log.resize(logBuffer().size());
+  logBuffer().read(log.data(), log.size());
+
+  const auto location = std::string(__FILE__ ":");
+  ASSERT_EQ(location + std::to_string(line) + ": pump 3 at 1.50 bar\n" + location + std::to_string(line + 1) +
+              ": valve open\n",
+            decode(log));
+}
+#endif
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <lil/Lz.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+std::string telemetry(size_t lines)
+{
+  std::string text;
+  for (size_t line = 0; line < lines; ++line)
+  {
+    text += std::to_string(1700000000000 + (line * 10)) + ",imu/" + std::to_string(line % 3) + ",accel," +
+            std::to_string(980 + (line % 7)) + ",OK\n";
+  }
+  return text;
+}
+
+std::vector<std::string> texts()
+{
+  std::mt19937 random(11);
+  std::string  noise(3000, '\0');
+  for (auto& byte : noise)
+  {
+    byte = static_cast<char>(random());
+  }
+  return { "", "a", "abcabcabcabcabc", std::string(1000, 'z'), noise, telemetry(200) };
+}
+
+/** @brief Streams text through encoder chunk bytes at a time, on both sides. */
+template <typename Encoder>
+std::string compress(Encoder& encoder, const std::string& text, size_t chunk)
+{
+  std::string       compressed;
+  std::vector<char> buffer(chunk);
+  size_t            offset = 0;
+  while (!encoder.finished())
+  {
+    if (offset < text.size())
+    {
+      offset += encoder.sink(&text[offset], minimum(chunk, text.size() - offset));
+    }
+    else
+    {
+      encoder.finish();
+    }
+    compressed.append(buffer.data(), encoder.poll(buffer.data(), chunk));
+  }
+  return compressed;
+}
+
+template <typename Decoder>
+std::string decompress(Decoder& decoder, const std::string& compressed, size_t chunk)
+{
+  std::string       text;
+  std::vector<char> buffer(chunk);
+  size_t            offset = 0;
+  for (;;)
+  {
+    if (offset < compressed.size())
+    {
+      offset += decoder.sink(&compressed[offset], minimum(chunk, compressed.size() - offset));
+    }
+    const auto count = decoder.poll(buffer.data(), chunk);
+    text.append(buffer.data(), count);
+    if ((count == 0) && (offset == compressed.size()))
+    {
+      return text;
+    }
+  }
+}
+
+template <uint8_t WindowBits, uint8_t LookaheadBits>
+void expectLzssRoundTrips()
+{
+  static LzssEncoder<WindowBits, LookaheadBits> encoder;
+  static LzssDecoder<WindowBits, LookaheadBits> decoder;
+  for (const auto& text : texts())
+  {
+    for (const size_t chunk : { 1, 7, 4096 })
+    {
+      encoder.reset();
+      decoder.reset();
+      const auto compressed = compress(encoder, text, chunk);
+      ASSERT_EQ(text, decompress(decoder, compressed, chunk)) << text.size() << " bytes in chunks of " << chunk;
+    }
+  }
+}
+
+std::string lz4Compress(const std::string& text)
+{
+  static Lz4Encoder<> encoder;
+  std::string         compressed(lz4Bound(text.size()), '\0');
+  const auto          size = encoder.compress(text.data(), text.size(), compressed.data(), compressed.size());
+  EXPECT_TRUE(size.ok());
+  compressed.resize(size.value_or(0));
+  return compressed;
+}
+}  // namespace
+
+TEST(LzTest, LzssRoundTripsInAnyChunks)
+{
+  expectLzssRoundTrips<4, 3>();
+  expectLzssRoundTrips<8, 4>();
+  expectLzssRoundTrips<11, 4>();
+}
+
+TEST(LzTest, LzssShrinksTelemetry)
+{
+  static LzssEncoder<8, 4> encoder;
+  const auto               text = telemetry(200);
+
+  const auto compressed = compress(encoder, text, 64);
+  ASSERT_LT(compressed.size(), text.size() / 2);
+
+  // A reset encoder starts over without the previous stream's history
+  encoder.reset();
+  ASSERT_EQ(compressed, compress(encoder, text, 4096));
+}
+
+TEST(LzTest, Lz4RoundTripsBlocks)
+{
+  auto cases = texts();
+  for (size_t size = 0; size < 64; ++size)
+  {
+    cases.push_back(telemetry(2).substr(0, size));
+  }
+  for (const auto& text : cases)
+  {
+    const auto compressed = lz4Compress(text);
+    std::string decompressed(text.size() + 1, '\0');
+    const auto  size = lz4Decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size());
+    ASSERT_TRUE(size.ok()) << text.size();
+    decompressed.resize(*size);
+    ASSERT_EQ(text, decompressed);
+  }
+  ASSERT_LT(lz4Compress(telemetry(200)).size(), telemetry(200).size() / 2);
+}
+
+TEST(LzTest, Lz4ReadsBlocksFromOtherEncoders)
+{
+  // "abc", then 9 bytes from 3 back, then the last literals "defgh"
+  const uint8_t block[] = { 0x35, 'a', 'b', 'c', 3, 0, 0x50, 'd', 'e', 'f', 'g', 'h' };
+  char          text[32];
+
+  const auto size = lz4Decompress(block, sizeof(block), text, sizeof(text));
+  ASSERT_TRUE(size.ok());
+  ASSERT_EQ("abcabcabcabcdefgh", std::string(text, *size));
+
+  const uint8_t empty[] = { 0x00 };
+  ASSERT_EQ(0U, lz4Decompress(empty, sizeof(empty), text, sizeof(text)).value_or(1));
+}
+
+TEST(LzTest, Lz4RejectsMalformedBlocks)
+{
+  char text[32];
+
+  const uint8_t distanceZero[]   = { 0x14, 'a', 0, 0, 0x00 };
+  const uint8_t distanceBefore[] = { 0x14, 'a', 2, 0, 0x00 };
+  const uint8_t truncated[]      = { 0x50, 'a', 'b' };
+  const uint8_t longRun[]        = { 0x1F, 'a', 1, 0, 255, 0x00 };
+  ASSERT_EQ(DECODE_FAIL, lz4Decompress(distanceZero, 0, text, sizeof(text)).err());
+  ASSERT_EQ(DECODE_FAIL, lz4Decompress(distanceZero, sizeof(distanceZero), text, sizeof(text)).err());
+  ASSERT_EQ(DECODE_FAIL, lz4Decompress(distanceBefore, sizeof(distanceBefore), text, sizeof(text)).err());
+  ASSERT_EQ(DECODE_FAIL, lz4Decompress(truncated, sizeof(truncated), text, sizeof(text)).err());
+  ASSERT_EQ(RESOURCE_FULL, lz4Decompress(longRun, sizeof(longRun), text, sizeof(text)).err());
+
+  static Lz4Encoder<8> encoder;
+  const auto           telemetryText = telemetry(20);
+  ASSERT_EQ(RESOURCE_FULL, encoder.compress(telemetryText.data(), telemetryText.size(), text, sizeof(text)).err());
+}
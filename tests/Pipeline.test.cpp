@@ -0,0 +1,137 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/Fixed.hpp>
+#include <lil/Pipeline.hpp>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+using Q16_16 = Fixed<16, 16>;
+
+TEST(PipelineTest, MovingAverageAveragesWindowPerChannel)
+{
+  MovingAverage<int, 4, 2> average;
+  int                      frames[][2] = { { 4, 40 }, { 8, 80 }, { 12, 120 }, { 16, 160 }, { 20, 200 } };
+
+  ASSERT_EQ(5U, average.process(frames, 5));
+  ASSERT_THAT(frames[3], ElementsAre(10, 100));
+  ASSERT_THAT(frames[4], ElementsAre(14, 140));
+}
+
+TEST(PipelineTest, MedianRejectsImpulses)
+{
+  Median<int, 3> median;
+  int            frames[][1] = { { 5 }, { 5 }, { 100 }, { 5 }, { 5 }, { -100 }, { 5 } };
+
+  median.process(frames, 7);
+
+  ASSERT_THAT(frames, ElementsAre(ElementsAre(0), ElementsAre(5), ElementsAre(5), ElementsAre(5), ElementsAre(5),
+                                  ElementsAre(5), ElementsAre(5)));
+}
+
+TEST(PipelineTest, BiquadAppliesCoefficients)
+{
+  // y[n] = x[n] + x[n - 1] + 0.5 * y[n - 1]
+  Biquad<float> biquad({ 1.0F, 1.0F, 0.0F, -0.5F, 0.0F });
+  float         first[][1]  = { { 1.0F }, { 1.0F } };
+  float         second[][1] = { { 1.0F } };
+
+  biquad.process(first, 2);
+  biquad.process(second, 1);
+
+  ASSERT_FLOAT_EQ(1.0F, first[0][0]);
+  ASSERT_FLOAT_EQ(2.5F, first[1][0]);
+  ASSERT_FLOAT_EQ(3.25F, second[0][0]);
+}
+
+TEST(PipelineTest, DecimateKeepsEveryFactorthFrame)
+{
+  Decimate<int, 3> decimate;
+  int              frames[][1] = { { 1 }, { 2 }, { 3 }, { 4 }, { 5 }, { 6 }, { 7 } };
+
+  ASSERT_EQ(2U, decimate.process(frames, 7));
+  ASSERT_EQ(3, frames[0][0]);
+  ASSERT_EQ(6, frames[1][0]);
+
+  int next[][1] = { { 8 }, { 9 } };
+  ASSERT_EQ(1U, decimate.process(next, 2));
+  ASSERT_EQ(9, next[0][0]);
+}
+
+TEST(PipelineTest, ProcessesInterleavedChannelsInOnePass)
+{
+  Pipeline pipeline{
+    Clip<int, 2>{ { -10, 10 } },
+    Deadband<int, 2>{ { -2, 2 }, 0 },
+    Decimate<int, 2, 2>{},
+  };
+  const int in[] = { 1, 50, -30, 3, 5, -1, 7, 9 };
+  int       out[8]{};
+
+  const auto written = pipeline.process(in, out, 4);
+
+  ASSERT_EQ(2U, written);
+  ASSERT_THAT(out, ElementsAre(-10, 3, 7, 9, 0, 0, 0, 0));
+}
+
+TEST(PipelineTest, DecimatesAcrossBlocks)
+{
+  using Drop = Decimate<int, 3>;
+
+  Pipeline         pipeline{ Drop{} };
+  constexpr size_t Frames = (decltype(pipeline)::Block_Frames * 2) + 5;
+  int              samples[Frames];
+  for (size_t i = 0; i < Frames; ++i)
+  {
+    samples[i] = static_cast<int>(i);
+  }
+
+  const auto written = pipeline.process(samples, samples, Frames);
+
+  ASSERT_EQ(Frames / 3, written);
+  for (size_t i = 0; i < written; ++i)
+  {
+    ASSERT_EQ(static_cast<int>((i * 3) + 2), samples[i]);
+  }
+}
+
+TEST(PipelineTest, MatchesStagesRunSeparately)
+{
+  using Average = MovingAverage<Q16_16, 4, 3>;
+  using Filter  = Biquad<Q16_16, 3>;
+  using Limit   = Clip<Q16_16, 3>;
+
+  const BiquadCoefficients<Q16_16> lowpass{ Q16_16(0.25F), Q16_16(0.5F), Q16_16(0.25F), Q16_16(-0.1F), Q16_16(0.05F) };
+  const Interval<Q16_16>           limits{ Q16_16(-20), Q16_16(20) };
+
+  Pipeline pipeline{ Average{}, Filter{ lowpass }, Limit{ limits } };
+  Average  average;
+  Filter   filter{ lowpass };
+  Limit    limit{ limits };
+
+  for (int i = 0; i < 64; ++i)
+  {
+    Q16_16 fused[] = { Q16_16(i % 17), Q16_16(-(i % 31)), Q16_16(i * 3 % 50) };
+    Q16_16 apart[] = { fused[0], fused[1], fused[2] };
+
+    ASSERT_TRUE(pipeline.process(fused));
+    average.process(&apart, 1);
+    filter.process(&apart, 1);
+    limit.process(&apart, 1);
+
+    ASSERT_EQ(apart[0], fused[0]);
+    ASSERT_EQ(apart[1], fused[1]);
+    ASSERT_EQ(apart[2], fused[2]);
+  }
+}
+
+TEST(PipelineTest, StagesAreAccessibleByIndex)
+{
+  Pipeline pipeline{ Clip<float>{ { 0.0F, 1.0F } }, Clip<float>{ { 0.0F, 0.5F } } };
+  float    frame[] = { 0.75F };
+
+  pipeline.stage<1>().range = Interval<float>{ 0.0F, 2.0F };
+  pipeline.process(frame);
+
+  ASSERT_FLOAT_EQ(0.75F, frame[0]);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <lil/Regex.hpp>
+#include <lil/Str.hpp>
+#include <regex>
+#include <string>
+#include <string_view>
+
+using namespace lil;
+
+namespace {
+using Identifier  = Regex<"[A-Za-z_][A-Za-z0-9_]*">;
+using TopicFilter = Regex<R"((?:[a-z0-9_]+|\+)(?:/(?:[a-z0-9_]+|\+))*(?:/#)?|#)">;
+using Version     = Regex<R"((\d+)\.(\d+)\.(\d+)(?:-(\w+))?)">;
+
+static_assert(Identifier::match("_imu0"), "Regex must match in constant expressions");
+static_assert(!Identifier::match("0imu"), "Regex must match in constant expressions");
+static_assert(Version::Groups == 4, "Groups must be counted at compile time");
+
+constexpr bool capturesInConstantExpressions()
+{
+  Version::Captures version;
+  return Version::match("1.22.333", version) && (version[2] == "22") && (version[4].data() == nullptr);
+}
+static_assert(capturesInConstantExpressions(), "Regex must capture in constant expressions");
+
+/** @brief Checks that Re agrees with std::regex on whether, where and how each text matches. */
+template <typename Re>
+void expectSameAsStdRegex(const char* pattern, std::initializer_list<const char*> texts)
+{
+  const std::regex expected(pattern);
+  for (const std::string text : texts)
+  {
+    std::smatch           fullMatch;
+    typename Re::Captures captures;
+    ASSERT_EQ(std::regex_match(text, fullMatch, expected), Re::match(text, captures)) << pattern << " on " << text;
+    ASSERT_EQ(std::regex_match(text, expected), Re::match(text)) << pattern << " on " << text;
+    for (size_t group = 0; fullMatch.ready() && !fullMatch.empty() && (group <= Re::Groups); ++group)
+    {
+      ASSERT_EQ(fullMatch[group].str(), std::string(captures[group])) << pattern << " on " << text << " " << group;
+    }
+
+    std::smatch found;
+    ASSERT_EQ(std::regex_search(text, found, expected), Re::search(text, captures)) << pattern << " on " << text;
+    ASSERT_EQ(std::regex_search(text, expected), Re::search(text)) << pattern << " on " << text;
+    for (size_t group = 0; !found.empty() && (group <= Re::Groups); ++group)
+    {
+      ASSERT_EQ(found[group].matched, captures[group].data() != nullptr) << pattern << " on " << text;
+      ASSERT_EQ(found[group].str(), std::string(captures[group])) << pattern << " on " << text << " group " << group;
+      if (found[group].matched)
+      {
+        ASSERT_EQ(found.position(group), captures[group].data() - text.data()) << pattern << " on " << text;
+      }
+    }
+  }
+}
+}  // namespace
+
+TEST(RegexTest, MatchesOurPatterns)
+{
+  ASSERT_TRUE(Identifier::match("Imu_raw2"));
+  ASSERT_FALSE(Identifier::match(""));
+  ASSERT_FALSE(Identifier::match("imu-raw"));
+
+  ASSERT_TRUE(TopicFilter::match("imu/+/raw"));
+  ASSERT_TRUE(TopicFilter::match("imu/#"));
+  ASSERT_TRUE(TopicFilter::match("#"));
+  ASSERT_FALSE(TopicFilter::match("imu/#/raw"));
+  ASSERT_FALSE(TopicFilter::match("imu/ra+w"));
+  ASSERT_FALSE(TopicFilter::match("imu//raw"));
+}
+
+TEST(RegexTest, CapturesViewTheText)
+{
+  const Str<32>     text("v10.2.0-rc1 built");
+  Version::Captures version;
+
+  ASSERT_FALSE(Version::match(text, version));
+  ASSERT_TRUE(Version::search(text, version));
+  ASSERT_EQ("10.2.0-rc1", version[0]);
+  ASSERT_EQ("10", version[1]);
+  ASSERT_EQ("rc1", version[4]);
+  ASSERT_EQ(text.data() + 1, version[0].data());
+}
+
+TEST(RegexTest, SyntaxAgreesWithStdRegex)
+{
+  expectSameAsStdRegex<Regex<"a|ab|abc">>("a|ab|abc", { "", "a", "ab", "abc", "xabcx" });
+  expectSameAsStdRegex<Regex<"(a*)(a|b)*b">>("(a*)(a|b)*b", { "b", "aab", "abab", "aaba", "ccab" });
+  expectSameAsStdRegex<Regex<"(a+?)(a*?)(b?)">>("(a+?)(a*?)(b?)", { "a", "aaab", "baaa" });
+  expectSameAsStdRegex<Regex<"x{2}y{1,3}z{2,}">>("x{2}y{1,3}z{2,}", { "xxyzz", "xxyyyyzz", "xxyyyzzzz", "xyzz" });
+  expectSameAsStdRegex<Regex<"(?:ab){1,2}?c">>("(?:ab){1,2}?c", { "abc", "ababc", "abababc" });
+  expectSameAsStdRegex<Regex<R"([^\s/]+\.[\d-]+)">>(R"([^\s/]+\.[\d-]+)", { "a.1", "x/y.2-3", "z .4", ". 5" });
+  expectSameAsStdRegex<Regex<R"((\w+)(?:=(\d*))?)">>(R"((\w+)(?:=(\d*))?)", { "x", "x=", "x=12", "=1", "a b=2" });
+  expectSameAsStdRegex<Regex<R"(^\W(\w)|$)">>(R"(^\W(\w)|$)", { "", "-x", "x-y", "--" });
+  expectSameAsStdRegex<Regex<R"([\]a-]+.[a\]])">>(R"([\]a-]+.[a\]])", { "]-a.]", "aaxa", "a]" });
+}
+
+TEST(RegexTest, RepeatedGroupsKeepWhatTheyLastMatched)
+{
+  // Unlike ECMAScript, which std::regex follows, a group keeps its capture through later iterations of an outer one
+  using Letters = Regex<"((a)|(b))+">;
+
+  const std::string_view text = "abb";
+  Letters::Captures      captures;
+
+  ASSERT_TRUE(Letters::match(text, captures));
+  ASSERT_EQ("a", captures[2]);
+  ASSERT_EQ(text.data(), captures[2].data());
+  ASSERT_EQ("b", captures[3]);
+  ASSERT_EQ(text.data() + 2, captures[3].data());
+}
+
+TEST(RegexTest, MatchesWithTheNfaWhenTheDfaWouldBeTooLarge)
+{
+  // The DFA must remember the last 9 letters: 512 states
+  expectSameAsStdRegex<Regex<"(a|b)*a(a|b){8}">>("(a|b)*a(a|b){8}", { "abababababab", "bbbbbbbbbbbb", "abbbbbbbb" });
+}
+
+TEST(RegexTest, IsLinearWherePatternsBacktrack)
+{
+  const std::string text(4096, 'a');
+
+  ASSERT_FALSE(Regex<"(a*)*b">::match(text));
+  ASSERT_FALSE(Regex<"(a|aa)+$b">::search(text));
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <lil/Result.hpp>
+
+using namespace lil;
+
+static_assert(std::is_trivially_copyable<Result<uint32_t>>::value, "Result should be trivially copyable");
+static_assert(std::is_trivially_copyable<Result<int*>>::value, "Result should be trivially copyable");
+static_assert(std::is_trivially_copyable<Result<void>>::value, "Result should be trivially copyable");
+static_assert(sizeof(Result<uint32_t>) == 8, "Result should pack Err beside small values");
+static_assert(sizeof(Result<int*>) == sizeof(int*), "Result<T*> should use the pointer niche");
+static_assert(sizeof(Result<void>) == sizeof(uint16_t), "Result<void> should only hold Err");
+static_assert(Result<int>(5).value() == 5, "Result should be usable at compile time");
+static_assert(Result<int>(BAD_ALLOC).err() == BAD_ALLOC, "Err should take precedence over int conversion");
+
+namespace {
+Result<int> parseDigit(char c)
+{
+  if ((c < '0') || (c > '9'))
+  {
+    return INVALID_FORMAT;
+  }
+  return c - '0';
+}
+}  // namespace
+
+TEST(ResultTest, HoldsValueOrErr)
+{
+  const auto digit = parseDigit('7');
+  const auto error = parseDigit('x');
+
+  ASSERT_TRUE(digit.ok());
+  ASSERT_EQ(NONE, digit.err());
+  ASSERT_EQ(7, *digit);
+  ASSERT_FALSE(error);
+  ASSERT_EQ(INVALID_FORMAT, error.err());
+  ASSERT_EQ(-1, error.value_or(-1));
+}
+
+TEST(ResultTest, PointerUsesNiche)
+{
+  int          value = 42;
+  Result<int*> found(&value);
+  Result<int*> null(static_cast<int*>(nullptr));
+  Result<int*> missing(RESOURCE_EMPTY);
+  Result<int*> last(static_cast<Err>(ERROR_MAX - 1));
+
+  ASSERT_TRUE(found.ok());
+  ASSERT_EQ(42, *found);
+  ASSERT_TRUE(null.ok());
+  ASSERT_EQ(nullptr, null.value());
+  ASSERT_FALSE(missing.ok());
+  ASSERT_EQ(RESOURCE_EMPTY, missing.err());
+  ASSERT_EQ(&value, missing.value_or(&value));
+  ASSERT_EQ(static_cast<Err>(ERROR_MAX - 1), last.err());
+}
+
+TEST(ResultTest, VoidHoldsOnlyErr)
+{
+  const Result<void> done;
+  const Result<void> failed = TX_FAIL;
+
+  ASSERT_TRUE(done.ok());
+  ASSERT_EQ(TX_FAIL, failed.err());
+}
+
+TEST(ResultTest, ArrowAccessesMembers)
+{
+  struct Point {
+    int x;
+    int y;
+  };
+  Result<Point> point(Point{ 1, 2 });
+
+  point->y = 3;
+
+  ASSERT_EQ(3, point.value().y);
+}
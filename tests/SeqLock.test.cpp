@@ -0,0 +1,94 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <lil/SeqLock.hpp>
+#include <thread>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+struct Calibration {
+  uint32_t generation;
+  float    gain[5];
+  uint8_t  flags;
+  uint32_t check;
+};
+
+Calibration calibrationFor(uint32_t generation)
+{
+  Calibration calibration{};
+  calibration.generation = generation;
+  for (auto& gain : calibration.gain)
+  {
+    gain = static_cast<float>(generation) * 0.5F;
+  }
+  calibration.flags = static_cast<uint8_t>(generation);
+  calibration.check = ~generation;
+  return calibration;
+}
+
+bool consistent(const Calibration& calibration)
+{
+  const auto expected = calibrationFor(calibration.generation);
+  for (size_t i = 0; i < 5; ++i)
+  {
+    if (calibration.gain[i] != expected.gain[i])
+    {
+      return false;
+    }
+  }
+  return (calibration.flags == expected.flags) && (calibration.check == expected.check);
+}
+}  // namespace
+
+TEST(SeqLockTest, ReadsLatestWrite)
+{
+  SeqLock<Calibration> lock(calibrationFor(1));
+  ASSERT_EQ(1U, lock.read().generation);
+  ASSERT_EQ(0U, lock.version());
+
+  lock.write(calibrationFor(2));
+  const auto value = lock.tryRead();
+  ASSERT_TRUE(value.ok());
+  ASSERT_EQ(2U, value->generation);
+  ASSERT_TRUE(consistent(*value));
+  ASSERT_EQ(1U, lock.version());
+
+  SeqLock<uint16_t> small(7);
+  small.write(9);
+  ASSERT_EQ(9, small.read());
+}
+
+TEST(SeqLockTest, ReadersNeverSeeTornWrites)
+{
+  SeqLock<Calibration>     lock(calibrationFor(0));
+  std::atomic<bool>        stop{ false };
+  std::atomic<uint32_t>    torn{ 0 };
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 3; ++i)
+  {
+    readers.emplace_back([&] {
+      uint32_t last = 0;
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        const auto value = lock.read();
+        if (!consistent(value) || (value.generation < last))
+        {
+          torn.fetch_add(1);
+        }
+        last = value.generation;
+      }
+    });
+  }
+  for (uint32_t generation = 1; generation <= 20000; ++generation)
+  {
+    lock.write(calibrationFor(generation));
+  }
+  stop = true;
+  for (auto& reader : readers)
+  {
+    reader.join();
+  }
+  ASSERT_EQ(0U, torn.load());
+  ASSERT_EQ(20000U, lock.read().generation);
+}
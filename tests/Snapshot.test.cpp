@@ -0,0 +1,82 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <lil/Snapshot.hpp>
+#include <thread>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+struct Limits {
+  uint32_t generation;
+  int32_t  low;
+  int32_t  high;
+  uint8_t  padding[52];
+};
+
+Limits limitsFor(uint32_t generation)
+{
+  Limits limits{};
+  limits.generation = generation;
+  limits.low        = -static_cast<int32_t>(generation);
+  limits.high       = static_cast<int32_t>(generation);
+  for (auto& byte : limits.padding)
+  {
+    byte = static_cast<uint8_t>(generation);
+  }
+  return limits;
+}
+
+bool consistent(const Limits& limits)
+{
+  const auto expected = limitsFor(limits.generation);
+  return memcmp(&expected, &limits, sizeof(Limits)) == 0;
+}
+}  // namespace
+
+TEST(SnapshotTest, ReadsLatestPublish)
+{
+  Snapshot<Limits> snapshot(limitsFor(1));
+  ASSERT_EQ(1U, snapshot.read().generation);
+  for (uint32_t generation = 2; generation < 6; ++generation)
+  {
+    snapshot.publish(limitsFor(generation));
+    const auto limits = snapshot.read();
+    ASSERT_EQ(generation, limits.generation);
+    ASSERT_TRUE(consistent(limits));
+  }
+}
+
+TEST(SnapshotTest, ReadersNeverSeeTornPublishes)
+{
+  Snapshot<Limits>         snapshot(limitsFor(0));
+  std::atomic<bool>        stop{ false };
+  std::atomic<uint32_t>    torn{ 0 };
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 3; ++i)
+  {
+    readers.emplace_back([&] {
+      uint32_t last = 0;
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        const auto limits = snapshot.read();
+        if (!consistent(limits) || (limits.generation < last))
+        {
+          torn.fetch_add(1);
+        }
+        last = limits.generation;
+      }
+    });
+  }
+  for (uint32_t generation = 1; generation <= 20000; ++generation)
+  {
+    snapshot.publish(limitsFor(generation));
+  }
+  stop = true;
+  for (auto& reader : readers)
+  {
+    reader.join();
+  }
+  ASSERT_EQ(0U, torn.load());
+  ASSERT_EQ(20000U, snapshot.read().generation);
+}
@@ -227,6 +227,43 @@ TEST(StrTest, EraseByIterator)
   ASSERT_STREQ("", actual.c_str());
 }
 
+namespace {
+constexpr Str<8> editedAtCompileTime()
+{
+  Str<8> str = str_literal("1234567");
+  str.erase(1, 3).insert(0, 2, '-').insert(3, "ab", 2).append(1, '!');
+  return str;
+}
+}  // namespace
+
+TEST(StrTest, EditsInConstantExpressions)
+{
+  constexpr auto edited = editedAtCompileTime();
+  static_assert(edited.size() == 7, "Str edits should be usable in constant expressions");
+  static_assert((edited[0] == '-') && (edited[2] == '1') && (edited[3] == 'a') && (edited[6] == '6'),
+                "Str edits should truncate at compile time as at runtime");
+  ASSERT_STREQ("--1ab56", edited.c_str());
+}
+
+TEST(StrTest, OverflowingInsertKeepsTheCharactersThatFit)
+{
+  Str<11> actual = "01234567";
+
+  actual.insert(2, "abcde");
+  ASSERT_EQ(10u, actual.size());
+  ASSERT_STREQ("01abcde234", actual.c_str());
+}
+
+TEST(StrTest, LargestCapacityTracksItsSize)
+{
+  Str<255> actual;
+  ASSERT_EQ(0u, actual.size());
+
+  actual.append(300, 'x');
+  ASSERT_EQ(254u, actual.size());
+  ASSERT_TRUE(actual.full());
+}
+
 TEST(StrTest, Builder)
 {
   //  const auto lhs          = StrLiteral("abc");
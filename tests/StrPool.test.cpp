@@ -0,0 +1,143 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <lil/StrPool.hpp>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+using namespace lil;
+
+static_assert(sizeof(StrId<255>) == 1, "StrId must be as narrow as its pool allows");
+static_assert(sizeof(StrId<256>) == 2, "StrId must be as narrow as its pool allows");
+
+namespace {
+constexpr StrPool<8, 64> Seed{ str_literal("degC"), str_literal("m/s"), str_literal("imu") };
+constexpr auto           Celsius = Seed.find(str_literal("degC")).value();
+constexpr auto           Imu     = Seed.find("imu").value();
+
+static_assert(Celsius.index == 0, "Keys must be interned in order");
+static_assert(Imu.index == 2, "Keys must be interned in order");
+static_assert(Seed.size() == 3, "Keys must be interned at compile time");
+static_assert(!Seed.find("rpm"), "Only the keys may be interned");
+}  // namespace
+
+TEST(StrPoolTest, InterningTheSameTextTwiceGivesTheSameId)
+{
+  StrPool<4, 64> pool;
+
+  const auto first  = pool.intern("sensor");
+  const auto second = pool.intern(std::string("sensor").c_str());
+
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  ASSERT_EQ(*first, *second);
+  ASSERT_NE(*first, *pool.intern("sensors"));
+  ASSERT_EQ(2U, pool.size());
+  ASSERT_EQ(sizeof("sensor") + 1 + sizeof("sensors") + 1, pool.bytesUsed());
+  ASSERT_STREQ("sensor", pool.c_str(*first));
+  ASSERT_EQ(6U, pool.length(*first));
+}
+
+TEST(StrPoolTest, InternsTextWithEmbeddedNulsAndTheEmptyString)
+{
+  StrPool<4, 64> pool;
+
+  const auto empty    = pool.intern("", 0);
+  const auto embedded = pool.intern("a\0b", 3);
+
+  ASSERT_TRUE(empty);
+  ASSERT_TRUE(embedded);
+  ASSERT_NE(*empty, *embedded);
+  ASSERT_EQ(0U, pool.length(*empty));
+  ASSERT_EQ(3U, pool.length(*embedded));
+  ASSERT_EQ(*embedded, *pool.find("a\0b", 3));
+  ASSERT_FALSE(pool.find("a", 1));
+}
+
+TEST(StrPoolTest, FindDoesNotIntern)
+{
+  StrPool<4, 64> pool;
+
+  ASSERT_EQ(INVALID_ARGUMENT, pool.find("topic").err());
+  ASSERT_EQ(0U, pool.size());
+
+  const auto id = pool.intern(str_literal("topic"));
+  ASSERT_EQ(*id, *pool.find(str_literal("topic")));
+}
+
+TEST(StrPoolTest, FullPoolStillFindsWhatItHolds)
+{
+  StrPool<2, 16> byCount;
+  ASSERT_TRUE(byCount.intern("a"));
+  ASSERT_TRUE(byCount.intern("b"));
+  ASSERT_EQ(RESOURCE_FULL, byCount.intern("c").err());
+  ASSERT_TRUE(byCount.intern("b"));
+
+  StrPool<4, 9> byBytes;
+  ASSERT_TRUE(byBytes.intern("abcd"));
+  ASSERT_EQ(RESOURCE_FULL, byBytes.intern("ef").err());
+  ASSERT_TRUE(byBytes.intern("e"));
+  ASSERT_EQ(9U, byBytes.bytesUsed());
+
+  StrPool<4, 1024> byLength;
+  const std::string tooLong(StrPool<4, 1024>::Max_Length + 1, 'x');
+  ASSERT_EQ(INVALID_ARGUMENT, byLength.intern(tooLong.c_str()).err());
+  ASSERT_TRUE(byLength.intern(tooLong.c_str(), tooLong.size() - 1));
+}
+
+TEST(StrPoolTest, CopyOfACompileTimePoolKeepsItsIds)
+{
+  auto pool = Seed;
+
+  ASSERT_EQ(Celsius, *pool.intern("degC"));
+  ASSERT_STREQ("m/s", pool.c_str(*pool.find("m/s")));
+
+  const auto added = pool.intern("rpm");
+  ASSERT_EQ(3U, added->index);
+  ASSERT_FALSE(Seed.find("rpm"));
+}
+
+TEST(StrPoolTest, IdsHashAsTheirIndex)
+{
+  StrPool<300, 4096> pool;
+
+  using Id = StrPool<300, 4096>::Id;
+
+  std::unordered_set<Id> ids;
+  for (int i = 0; i < 300; ++i)
+  {
+    const auto id = pool.intern(std::to_string(i).c_str());
+    ASSERT_TRUE(id);
+    ASSERT_EQ(static_cast<size_t>(i), std::hash<Id>()(*id));
+    ids.insert(*id);
+  }
+  ASSERT_EQ(300U, ids.size());
+  ASSERT_EQ(2U, sizeof(Id));
+}
+
+TEST(StrPoolTest, ReadersFindWhatIsBeingInterned)
+{
+  static StrPool<512, 8192> pool;
+  std::atomic<bool>         done{ false };
+
+  std::thread reader([&] {
+    size_t seen = 0;
+    while (!done.load(std::memory_order_acquire) || (seen < 512))
+    {
+      const auto text = std::to_string(seen);
+      if (const auto id = pool.find(text.c_str()))
+      {
+        ASSERT_EQ(seen, id->index);
+        ASSERT_STREQ(text.c_str(), pool.c_str(*id));
+        ++seen;
+      }
+    }
+  });
+
+  for (int i = 0; i < 512; ++i)
+  {
+    ASSERT_TRUE(pool.intern(std::to_string(i).c_str()));
+  }
+  done.store(true, std::memory_order_release);
+  reader.join();
+}
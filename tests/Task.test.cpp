@@ -0,0 +1,207 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/ByteRing.hpp>
+#include <lil/Task.hpp>
+#include <vector>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+namespace {
+uint32_t Ticks = 0;
+
+uint32_t fakeClock() noexcept
+{
+  return Ticks;
+}
+
+Task<int> twice(int value)
+{
+  co_return value * 2;
+}
+
+Task<int> sumOfTwice(int a, int b)
+{
+  const auto x = co_await twice(a);
+  const auto y = co_await twice(b);
+  co_return *x + *y;
+}
+
+Task<void> record(std::vector<int>& order, int id, int steps)
+{
+  for (int i = 0; i < steps; ++i)
+  {
+    order.push_back(id);
+    co_await yield();
+  }
+}
+
+Task<int> waitFor(Event& event, uint32_t timeout)
+{
+  const auto woken = co_await event.wait(timeout);
+  if (!woken)
+  {
+    co_return woken.err();
+  }
+  co_return static_cast<int>(Ticks);
+}
+
+Task<int> failAfterYield()
+{
+  co_await yield();
+  throw 1;
+}
+
+Task<int> awaitFailure()
+{
+  const auto failed = co_await failAfterYield();
+  co_return failed.ok() ? 0 : static_cast<int>(failed.err());
+}
+}  // namespace
+
+TEST(TaskTest, AwaitsNestedTasks)
+{
+  Executor executor(fakeClock);
+  auto     task = sumOfTwice(3, 4);
+
+  ASSERT_EQ(NONE, executor.spawn(task));
+  executor.run();
+
+  ASSERT_TRUE(task.done());
+  ASSERT_EQ(14, task.result().value());
+}
+
+TEST(TaskTest, YieldInterleavesTasks)
+{
+  Executor         executor(fakeClock);
+  std::vector<int> order;
+
+  executor.spawn(record(order, 1, 2));
+  executor.spawn(record(order, 2, 3));
+  executor.run();
+
+  ASSERT_THAT(order, ElementsAre(1, 2, 1, 2, 2));
+  ASSERT_EQ(0U, taskFramePool().used());
+}
+
+TEST(TaskTest, ExhaustedFramePoolYieldsBadAlloc)
+{
+  Executor          executor(fakeClock);
+  std::vector<Task<int>> held;
+  for (size_t i = 0; i < taskFramePool().capacity(); ++i)
+  {
+    held.push_back(twice(1));
+  }
+
+  auto overflow = twice(1);
+
+  ASSERT_TRUE(overflow.done());
+  ASSERT_EQ(BAD_ALLOC, overflow.result().err());
+  ASSERT_EQ(BAD_ALLOC, executor.spawn(overflow));
+
+  held.pop_back();
+  auto outer = sumOfTwice(1, 2);
+  held.pop_back();
+  executor.spawn(outer);
+  executor.run();
+  ASSERT_EQ(6, outer.result().value());
+}
+
+TEST(TaskTest, DelayResumesAfterDeadline)
+{
+  Executor         executor(fakeClock);
+  std::vector<int> woken;
+  auto             sleeper = [](std::vector<int>& log, uint32_t ticks) -> Task<void> {
+    co_await delay(ticks);
+    log.push_back(static_cast<int>(ticks));
+  };
+
+  Ticks = 100;
+  executor.spawn(sleeper(woken, 20));
+  executor.spawn(sleeper(woken, 10));
+  executor.runOnce();
+  ASSERT_EQ(10U, executor.idleTicks());
+
+  Ticks = 110;
+  executor.runOnce();
+  ASSERT_THAT(woken, ElementsAre(10));
+
+  Ticks = 125;
+  executor.runOnce();
+  ASSERT_THAT(woken, ElementsAre(10, 20));
+  ASSERT_EQ(0U, executor.tasks());
+}
+
+TEST(TaskTest, EventWakesWaitersOrTimesOut)
+{
+  Executor executor(fakeClock);
+  Event    event;
+  Ticks       = 0;
+  auto patient = waitFor(event, Forever);
+  auto hasty   = waitFor(event, 5);
+
+  executor.spawn(patient);
+  executor.spawn(hasty);
+  executor.runOnce();
+  Ticks = 5;
+  executor.runOnce();
+  ASSERT_EQ(OPERATION_TIMED_OUT, hasty.result().err());
+  ASSERT_FALSE(patient.done());
+
+  Ticks = 7;
+  event.set();
+  executor.runOnce();
+  ASSERT_EQ(7, patient.result().value());
+}
+
+TEST(TaskTest, ReadableWaitsForRingData)
+{
+  Executor    executor(fakeClock);
+  ByteRing<8> ring;
+  auto        reader = [](ByteRing<8>& rx) -> Task<uint8_t> {
+    if (auto ready = co_await readable(rx, 2, 50); !ready)
+    {
+      co_return ready.err();
+    }
+    uint8_t bytes[2];
+    rx.read(bytes, sizeof(bytes));
+    co_return static_cast<uint8_t>(bytes[0] + bytes[1]);
+  };
+  Ticks     = 0;
+  auto task = reader(ring);
+
+  executor.spawn(task);
+  executor.runOnce();
+  const uint8_t first = 3;
+  ring.write(&first, 1);
+  executor.runOnce();
+  ASSERT_FALSE(task.done());
+
+  const uint8_t second = 4;
+  ring.write(&second, 1);
+  executor.runOnce();
+  ASSERT_EQ(7, task.result().value());
+
+  auto starved = reader(ring);
+  executor.spawn(starved);
+  executor.runOnce();
+  Ticks = 50;
+  executor.runOnce();
+  ASSERT_EQ(OPERATION_TIMED_OUT, starved.result().err());
+}
+
+TEST(TaskTest, EscapedExceptionAbortsTask)
+{
+  Executor executor(fakeClock);
+  auto     failing  = failAfterYield();
+  auto     awaiting = awaitFailure();
+
+  executor.spawn(failing);
+  executor.spawn(awaiting);
+  executor.run();
+
+  ASSERT_TRUE(failing.done());
+  ASSERT_EQ(OPERATION_ABORTED, failing.result().err());
+  ASSERT_EQ(static_cast<int>(OPERATION_ABORTED), awaiting.result().value());
+  ASSERT_EQ(0U, executor.tasks());
+}
@@ -0,0 +1,105 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/Telemetry.hpp>
+#include <string.h>
+#include <string>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+namespace {
+Err      Last_Failure = NONE;
+uint32_t Last_Id      = 0;
+
+constexpr auto Check_Line = __LINE__ + 4;  // Of the LIL_ASSERT below
+
+bool checkPositive(int value)
+{
+  LIL_ASSERT(value > 0, INVALID_ARGUMENT);
+  return value > 0;
+}
+}  // namespace
+
+void lil::AssertFail(Err err, uint32_t id)
+{
+  Last_Failure = err;
+  Last_Id      = id;
+}
+
+TEST(TelemetryTest, SnapshotDifferenceCountsOccurrencesSinceEarlier)
+{
+  const auto before = ErrSnapshot::take();
+
+  countErr(CHECKSUM);
+  countErr(CHECKSUM);
+  ASSERT_EQ(BAD_ALLOC, countErr(BAD_ALLOC));
+  countErr(NONE);
+  const auto delta = ErrSnapshot::take() - before;
+
+  ASSERT_EQ(2U, delta[CHECKSUM]);
+  ASSERT_EQ(1U, delta[BAD_ALLOC]);
+  ASSERT_EQ(0U, delta[PARITY]);
+  ASSERT_EQ(3U, delta.total());
+}
+
+TEST(TelemetryTest, FormatsNonzeroCountsIntoStr)
+{
+  const auto before = ErrSnapshot::take();
+  countErr(RETRY);
+  countErr(static_cast<Err>(USER_ERROR + 5));
+  countErr(static_cast<Err>(USER_ERROR + 5));
+  const auto delta = ErrSnapshot::take() - before;
+
+  Str<32> text;
+  ASSERT_EQ(NONE, format(delta, text));
+  ASSERT_STREQ("RETRY=1 USER_ERROR+5=2", text.c_str());
+
+  Str<16> small;
+  ASSERT_EQ(RESOURCE_FULL, format(delta, small));
+  ASSERT_STREQ("RETRY=1", small.c_str());
+}
+
+TEST(TelemetryTest, SerializesNonzeroCountsAsLittleEndian)
+{
+  const auto before = ErrSnapshot::take();
+  countErr(NAK);
+  const auto delta = ErrSnapshot::take() - before;
+  uint8_t    bytes[8]{};
+
+  const auto written = serialize(delta, bytes, sizeof(bytes));
+
+  ASSERT_TRUE(written.ok());
+  ASSERT_EQ(8U, *written);
+  ASSERT_THAT(bytes, ElementsAre(1, 0, NAK, 0, 1, 0, 0, 0));
+  ASSERT_EQ(RESOURCE_FULL, serialize(delta, bytes, 7).err());
+}
+
+TEST(TelemetryTest, AssertSitesCountFailures)
+{
+  ASSERT_TRUE(checkPositive(1));
+  ASSERT_EQ(nullptr, AssertSite::first());
+
+  ASSERT_FALSE(checkPositive(0));
+  ASSERT_FALSE(checkPositive(-1));
+
+  // The ID is the hash of the site's interned entry, as for LIL_LOG
+  const auto entry = std::string(LIL_LOG_MAGIC LIL_FILENAME ":") + std::to_string(Check_Line) + '\0' + "value > 0";
+  ASSERT_EQ(INVALID_ARGUMENT, Last_Failure);
+  ASSERT_EQ(fnv1a(entry.data(), entry.size()), Last_Id);
+  const auto* site = AssertSite::first();
+  ASSERT_NE(nullptr, site);
+  ASSERT_EQ(Last_Id, site->id());
+  ASSERT_EQ(2U, site->failures());
+  ASSERT_EQ(nullptr, site->next());
+
+  uint8_t    bytes[16]{};
+  const auto written = serializeAsserts(bytes, sizeof(bytes));
+  ASSERT_TRUE(written.ok());
+  ASSERT_EQ(10U, *written);
+  ASSERT_EQ(1, bytes[0]);
+  uint32_t id;
+  memcpy(&id, &bytes[2], sizeof(id));
+  ASSERT_EQ(Last_Id, id);
+  ASSERT_EQ(2, bytes[6]);
+  ASSERT_EQ(RESOURCE_FULL, serializeAsserts(bytes, 9).err());
+}
@@ -0,0 +1,86 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/Str.hpp>
+#include <lil/ThreadPool.hpp>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using namespace lil;
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce)
+{
+  ThreadPool                         pool(4);
+  std::vector<std::atomic<int>>      visits(10007);
+
+  parallelFor(pool, visits.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      visits[i].fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  for (const auto& count : visits)
+  {
+    ASSERT_EQ(1, count.load());
+  }
+}
+
+TEST(ThreadPoolTest, ParallelReduceMatchesSequentialSum)
+{
+  ThreadPool            pool(3);
+  std::vector<uint64_t> values(100000);
+  std::iota(values.begin(), values.end(), 1);
+
+  const auto sum = parallelReduce(pool, values.data(), values.size(), uint64_t{ 0 },
+                                  [](uint64_t total, uint64_t value) { return total + value; });
+
+  ASSERT_EQ(100000ULL * 100001ULL / 2, sum);
+  ASSERT_EQ(7U, parallelReduce(pool, values.data(), 0, uint64_t{ 7 }, std::plus<uint64_t>()));
+}
+
+TEST(ThreadPoolTest, ParallelReduceMergesWiderResults)
+{
+  ThreadPool           pool(3);
+  std::vector<uint8_t> samples(100000, 200);
+
+  // Partial sums overflow uint8_t, so they must be merged as uint64_t
+  const auto sum = parallelReduce(
+    pool, samples.data(), samples.size(), uint64_t{ 0 }, [](uint64_t total, uint8_t sample) { return total + sample; },
+    std::plus<uint64_t>());
+
+  ASSERT_EQ(20000000U, sum);
+}
+
+TEST(ThreadPoolTest, ParallelTransformAcceptsIArrRanges)
+{
+  ThreadPool pool(2);
+  Str<64>    text("parallel transform over a lil string");
+  char       upper[64]{};
+
+  parallelTransform(pool, text, upper, [](char c) { return static_cast<char>(((c >= 'a') && (c <= 'z')) ? c - 32 : c); });
+
+  ASSERT_STREQ("PARALLEL TRANSFORM OVER A LIL STRING", upper);
+}
+
+TEST(ThreadPoolTest, NestedJoinsAndSingleThreadPoolsComplete)
+{
+  for (size_t threads : { 1U, 2U, 8U })
+  {
+    ThreadPool pool(threads);
+    auto       fibonacci = [&pool](auto& self, int n) -> int {
+      if (n < 2)
+      {
+        return n;
+      }
+      int left  = 0;
+      int right = 0;
+      pool.join([&] { left = self(self, n - 1); }, [&] { right = self(self, n - 2); });
+      return left + right;
+    };
+
+    int result = 0;
+    pool.run([&] { result = fibonacci(fibonacci, 18); });
+    ASSERT_EQ(2584, result);
+  }
+}
@@ -0,0 +1,162 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/TimingWheel.hpp>
+#include <random>
+#include <vector>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+namespace {
+struct Firing {
+  uint32_t tick;
+  int      id;
+};
+
+template <typename Wheel>
+struct Recorder {
+  Wheel*              wheel;
+  std::vector<Firing> fired;
+};
+
+using SmallWheel = TimingWheel<16, 2>;
+
+void recordSmall(void* context, TimerId timer)
+{
+  auto* recorder = static_cast<Recorder<SmallWheel>*>(context);
+  recorder->fired.push_back({ recorder->wheel->now(), static_cast<int>(timer.index) });
+}
+}  // namespace
+
+TEST(TimingWheelTest, FiresEachTimerAtItsDeadline)
+{
+  SmallWheel             wheel(1000);
+  Recorder<SmallWheel>   recorder{ &wheel, {} };
+  std::vector<uint32_t>  delays{ 0, 1, 63, 64, 65, 4095, 4096, 10000 };
+  std::vector<TimerId>   ids;
+  for (auto delay : delays)
+  {
+    ids.push_back(*wheel.schedule(delay, recordSmall, &recorder));
+  }
+
+  wheel.advance(1000 + 20000);
+
+  ASSERT_EQ(delays.size(), recorder.fired.size());
+  for (size_t i = 0; i < delays.size(); ++i)
+  {
+    ASSERT_EQ(1000 + delays[i], recorder.fired[i].tick);
+    ASSERT_EQ(static_cast<int>(ids[i].index), recorder.fired[i].id);
+  }
+  ASSERT_EQ(0U, wheel.size());
+}
+
+TEST(TimingWheelTest, CancelAndRescheduleAreIdChecked)
+{
+  SmallWheel           wheel;
+  Recorder<SmallWheel> recorder{ &wheel, {} };
+  const auto           cancelled = *wheel.schedule(10, recordSmall, &recorder);
+  const auto           moved     = *wheel.schedule(10, recordSmall, &recorder);
+
+  ASSERT_EQ(NONE, wheel.cancel(cancelled));
+  ASSERT_EQ(INVALID_ARGUMENT, wheel.cancel(cancelled));
+  ASSERT_EQ(NONE, wheel.reschedule(moved, 300));
+  wheel.advance(299);
+  ASSERT_TRUE(recorder.fired.empty());
+
+  wheel.advance(300);
+  ASSERT_EQ(1U, recorder.fired.size());
+  ASSERT_EQ(300U, recorder.fired[0].tick);
+  ASSERT_FALSE(wheel.pending(moved));
+  ASSERT_EQ(INVALID_ARGUMENT, wheel.reschedule(moved, 1));
+}
+
+TEST(TimingWheelTest, StaleIdsStayStaleAcrossSlotReuse)
+{
+  TimingWheel<1> wheel;
+  auto           callback = [](void*, TimerId) {};
+  const auto     stale    = *wheel.schedule(10, callback, nullptr);
+  ASSERT_EQ(NONE, wheel.cancel(stale));
+
+  // Reuse the only node past a 16 bit generation wraparound
+  for (uint32_t i = 0; i < 0x10000 - 1; ++i)
+  {
+    ASSERT_EQ(NONE, wheel.cancel(*wheel.schedule(10, callback, nullptr)));
+  }
+  const auto live = *wheel.schedule(10, callback, nullptr);
+
+  ASSERT_EQ(stale.index, live.index);
+  ASSERT_FALSE(wheel.pending(stale));
+  ASSERT_EQ(INVALID_ARGUMENT, wheel.cancel(stale));
+  ASSERT_TRUE(wheel.pending(live));
+}
+
+TEST(TimingWheelTest, ReportsFullAndIdleTicks)
+{
+  TimingWheel<2> wheel(UINT32_MAX - 5);
+  int            fired    = 0;
+  auto           callback = [](void* count, TimerId) { ++*static_cast<int*>(count); };
+
+  ASSERT_EQ(TimingWheel<2>::Max_Delay, wheel.idleTicks());
+  ASSERT_TRUE(wheel.schedule(10, callback, &fired).ok());
+  ASSERT_TRUE(wheel.schedule(100, callback, &fired).ok());
+  ASSERT_EQ(RESOURCE_FULL, wheel.schedule(1, callback, &fired).err());
+  ASSERT_EQ(10U, wheel.idleTicks());
+
+  ASSERT_EQ(1U, wheel.advance(UINT32_MAX - 5 + 10));
+  ASSERT_EQ(1U, wheel.advance(UINT32_MAX - 5 + 100));
+  ASSERT_EQ(2, fired);
+}
+
+TEST(TimingWheelTest, MatchesReferenceUnderRandomWorkload)
+{
+  using Wheel = TimingWheel<256, 3>;
+  struct State {
+    Wheel*                wheel;
+    std::vector<uint32_t> expected;  // deadline per slot, or 0 when idle
+    size_t                fired = 0;
+  };
+
+  Wheel                     wheel(12345);
+  State                     state{ &wheel, std::vector<uint32_t>(256, 0) };
+  std::vector<TimerId>      ids(256);
+  std::mt19937              random(7);
+  auto                      callback = [](void* context, TimerId timer) {
+    auto* s = static_cast<State*>(context);
+    ASSERT_EQ(s->expected[timer.index], s->wheel->now());
+    s->expected[timer.index] = 0;
+    ++s->fired;
+  };
+
+  uint32_t now = 12345;
+  for (int step = 0; step < 20000; ++step)
+  {
+    const auto slot = random() % 256;
+    if (state.expected[slot] == 0)
+    {
+      const uint32_t delay = (random() % 4 == 0) ? (random() % 500000) : (random() % 300);
+      const auto     id    = wheel.schedule(delay, callback, &state);
+      if (id.ok())
+      {
+        ids[id->index]            = *id;
+        state.expected[id->index] = now + delay;
+      }
+    }
+    else if (random() % 2 == 0)
+    {
+      ASSERT_EQ(NONE, wheel.cancel(ids[slot]));
+      state.expected[slot] = 0;
+    }
+    else
+    {
+      const uint32_t delay = random() % 5000;
+      ASSERT_EQ(NONE, wheel.reschedule(ids[slot], delay));
+      state.expected[slot] = now + delay;
+    }
+    now += random() % 40;
+    wheel.advance(now);
+  }
+  wheel.advance(now + 600000);
+
+  ASSERT_EQ(0U, wheel.size());
+  ASSERT_GT(state.fired, 1000U);
+}
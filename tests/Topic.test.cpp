@@ -0,0 +1,150 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <lil/Topic.hpp>
+#include <thread>
+#include <vector>
+
+using namespace lil;
+using ::testing::ElementsAre;
+
+namespace {
+struct Sample {
+  uint32_t sequence;
+  float    value;
+};
+
+std::vector<uint32_t> drain(const Topic<Sample, 4, 3>::Subscriber& subscriber)
+{
+  std::vector<uint32_t> sequences;
+  while (auto sample = subscriber.receive())
+  {
+    sequences.push_back(sample->sequence);
+    subscriber.release(sample.value());
+  }
+  return sequences;
+}
+}  // namespace
+
+TEST(TopicTest, EverySubscriberReceivesTheSameSlot)
+{
+  Topic<Sample, 4, 3> topic{ str_literal("imu/raw") };
+  const auto          first  = *topic.subscribe();
+  const auto          second = *topic.subscribe();
+
+  auto slot = topic.loan();
+  ASSERT_TRUE(slot.ok());
+  *slot = { 7, 1.5F };
+  ASSERT_EQ(NONE, topic.publish(slot.value()));
+
+  const auto received = first.receive();
+  ASSERT_TRUE(received.ok());
+  ASSERT_EQ(slot.value(), received.value());
+  ASSERT_EQ(slot.value(), second.receive().value());
+  ASSERT_EQ(7U, received->sequence);
+  ASSERT_EQ(RESOURCE_EMPTY, first.receive().err());
+  ASSERT_STREQ("imu/raw", topic.name().c_str());
+}
+
+TEST(TopicTest, LaggingSubscriberHoldsSlotsUntilReleased)
+{
+  Topic<Sample, 4, 3> topic{ str_literal("adc") };
+  const auto          fast = *topic.subscribe();
+  const auto          slow = *topic.subscribe();
+
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    ASSERT_EQ(NONE, topic.publish(Sample{ i, 0.0F }));
+    ASSERT_THAT(drain(fast), ElementsAre(i));
+  }
+  ASSERT_EQ(RESOURCE_BUSY, topic.loan().err());
+  ASSERT_EQ(RESOURCE_BUSY, topic.publish(Sample{ 4, 0.0F }));
+  ASSERT_EQ(4U, slow.pending());
+
+  ASSERT_THAT(drain(slow), ElementsAre(0, 1, 2, 3));
+  ASSERT_EQ(NONE, topic.publish(Sample{ 5, 0.0F }));
+  ASSERT_THAT(drain(fast), ElementsAre(5));
+  ASSERT_THAT(drain(slow), ElementsAre(5));
+}
+
+TEST(TopicTest, FullQueueRejectsPublishForEverySubscriber)
+{
+  Topic<Sample, 8, 2, 2> topic{ str_literal("status") };
+  const auto             fast = *topic.subscribe();
+  const auto             slow = *topic.subscribe();
+  ASSERT_EQ(RESOURCE_FULL, topic.subscribe().err());
+
+  ASSERT_EQ(NONE, topic.publish(Sample{ 0, 0.0F }));
+  ASSERT_EQ(NONE, topic.publish(Sample{ 1, 0.0F }));
+  ASSERT_EQ(RESOURCE_FULL, topic.publish(Sample{ 2, 0.0F }));
+  ASSERT_EQ(2U, fast.pending());
+
+  // The rejected loan went back to the pool
+  for (int i = 0; i < 6; ++i)
+  {
+    auto slot = topic.loan();
+    ASSERT_TRUE(slot.ok());
+    ASSERT_EQ(RESOURCE_FULL, topic.publish(slot.value()));
+  }
+
+  while (auto sample = fast.receive())
+  {
+    fast.release(sample.value());
+  }
+  while (auto sample = slow.receive())
+  {
+    slow.release(sample.value());
+  }
+  ASSERT_EQ(NONE, topic.publish(Sample{ 3, 0.0F }));
+}
+
+TEST(TopicTest, FansOutAcrossThreads)
+{
+  constexpr uint32_t       Messages    = 20000;
+  constexpr size_t         Subscribers = 4;
+  Topic<Sample, 16, Subscribers, 8> topic{ str_literal("stress") };
+  std::vector<std::thread> consumers;
+  std::vector<uint64_t>    sums(Subscribers);
+  for (size_t i = 0; i < Subscribers; ++i)
+  {
+    consumers.emplace_back([&, i, subscriber = *topic.subscribe()] {
+      uint32_t expected = 0;
+      while (expected < Messages)
+      {
+        auto sample = subscriber.receive();
+        if (!sample)
+        {
+          std::this_thread::yield();
+          continue;
+        }
+        ASSERT_EQ(expected, sample->sequence);
+        sums[i] += static_cast<uint64_t>(sample->value);
+        subscriber.release(sample.value());
+        ++expected;
+      }
+    });
+  }
+
+  uint64_t expectedSum = 0;
+  for (uint32_t i = 0; i < Messages;)
+  {
+    auto slot = topic.loan();
+    if (!slot)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    *slot = { i, static_cast<float>(i % 1000) };
+    if (topic.publish(slot.value()) != NONE)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    expectedSum += i % 1000;
+    ++i;
+  }
+  for (auto& consumer : consumers)
+  {
+    consumer.join();
+  }
+  ASSERT_THAT(sums, ElementsAre(expectedSum, expectedSum, expectedSum, expectedSum));
+}
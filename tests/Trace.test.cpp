@@ -0,0 +1,159 @@
+#define LIL_TRACE_ENABLED true
+
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <lil/Trace.hpp>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace lil;
+
+namespace {
+struct Event {
+  std::string name;
+  double      ts;
+  double      dur;
+  uint32_t    tid;
+};
+
+/** @brief Flushes every pending zone and parses the events back, skipping the opening bracket if present. */
+std::vector<Event> flush(size_t chunk = 4096)
+{
+  std::string json;
+  std::string out(chunk, '\0');
+  for (;;)
+  {
+    const auto written = traceFlush(out.data(), out.size());
+    EXPECT_TRUE(written);
+    if (!written || (*written == 0))
+    {
+      break;
+    }
+    json.append(out.data(), *written);
+  }
+
+  static const std::regex event(R"re(\{"name":"((?:[^"\\]|\\.)*)","ph":"X",)re"
+                               R"re("ts":([0-9]+\.[0-9]{3}),"dur":([0-9]+\.[0-9]{3}),"pid":1,"tid":([0-9]+)\},\n)re");
+  std::vector<Event> events;
+  auto               begin = json.cbegin();
+  if (json.compare(0, 2, "[\n") == 0)
+  {
+    begin += 2;
+  }
+  std::smatch match;
+  while (std::regex_search(begin, json.cend(), match, event, std::regex_constants::match_continuous))
+  {
+    events.push_back({ match[1], std::stod(match[2]), std::stod(match[3]),
+                       static_cast<uint32_t>(std::stoul(match[4])) });
+    begin = match[0].second;
+  }
+  EXPECT_EQ(json.cend(), begin) << "unparsed trace: " << std::string(begin, json.cend());
+  return events;
+}
+
+void spin(std::chrono::microseconds duration)
+{
+  const auto end = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < end)
+  {
+  }
+}
+}  // namespace
+
+TEST(TraceTest, NestedZonesAreRecordedInsideEachOther)
+{
+  flush();
+  {
+    LIL_TRACE_ZONE("outer");
+    spin(std::chrono::microseconds(200));
+    {
+      LIL_TRACE_ZONE("inner \"quoted\"");
+      spin(std::chrono::microseconds(500));
+    }
+  }
+  const auto events = flush();
+
+  ASSERT_EQ(2U, events.size());
+  const auto& inner = events[0];
+  const auto& outer = events[1];
+  EXPECT_EQ("inner \\\"quoted\\\"", inner.name);
+  EXPECT_EQ("outer", outer.name);
+  EXPECT_EQ(inner.tid, outer.tid);
+  EXPECT_GE(inner.ts, outer.ts + 150);
+  EXPECT_LE(inner.ts + inner.dur, outer.ts + outer.dur);
+  EXPECT_GE(inner.dur, 450);
+  EXPECT_GE(outer.dur, inner.dur + 150);
+}
+
+TEST(TraceTest, SmallFlushesResumeWhereTheyStopped)
+{
+  flush();
+  for (int i = 0; i < 10; ++i)
+  {
+    LIL_TRACE_ZONE("step");
+  }
+  char tiny[8];
+  EXPECT_EQ(RESOURCE_FULL, traceFlush(tiny, sizeof(tiny)).err());
+
+  const auto events = flush(Trace_Event_Chars + 2);
+  ASSERT_EQ(10U, events.size());
+  for (const auto& event : events)
+  {
+    EXPECT_EQ("step", event.name);
+  }
+  EXPECT_TRUE(flush().empty());
+}
+
+TEST(TraceTest, FullBufferDropsNewZones)
+{
+  flush();
+  const auto dropped = traceDropped();
+  for (uint32_t i = 0; i < detail::Trace_Events + 5; ++i)
+  {
+    LIL_TRACE_ZONE("flood");
+  }
+  EXPECT_EQ(dropped + 5, traceDropped());
+  EXPECT_EQ(detail::Trace_Events, flush().size());
+
+  {
+    LIL_TRACE_ZONE("after");
+  }
+  EXPECT_EQ(dropped + 5, traceDropped());
+  EXPECT_EQ(1U, flush().size());
+}
+
+TEST(TraceTest, EachThreadHasItsOwnBuffer)
+{
+  flush();
+  constexpr size_t Threads = 4;
+  constexpr size_t Zones   = 100;
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < Threads; ++t)
+  {
+    threads.emplace_back([] {
+      for (size_t i = 0; i < Zones; ++i)
+      {
+        LIL_TRACE_ZONE("worker");
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  const auto events = flush();
+
+  ASSERT_EQ(Threads * Zones, events.size());
+  std::vector<uint32_t> tids;
+  for (const auto& event : events)
+  {
+    tids.push_back(event.tid);
+  }
+  std::sort(tids.begin(), tids.end());
+  tids.erase(std::unique(tids.begin(), tids.end()), tids.end());
+  EXPECT_EQ(Threads, tids.size());
+}
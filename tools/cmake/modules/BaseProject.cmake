@@ -22,6 +22,7 @@ set(isProjectMaintainer ON)
 
 option(${PROJECT_NAME}_BUILD_DOCS "Build tests for ${PROJECT_NAME}" ${isProjectMaintainer})
 option(${PROJECT_NAME}_BUILD_TESTS "Build tests for ${PROJECT_NAME}" ${isProjectMaintainer})
+option(${PROJECT_NAME}_BUILD_BENCHMARKS "Build benchmarks for ${PROJECT_NAME}" ${isProjectMaintainer})
 set(${PROJECT_NAME}_TEST_REGEX_FILTER
   ".*"
   CACHE PATH
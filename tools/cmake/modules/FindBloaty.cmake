@@ -0,0 +1,88 @@
+#[=======================================================================[.rst:
+FindBloaty
+----------
+
+.. _Bloaty: https://github.com/google/bloaty
+
+Generates targets that report how much code each template instantiation adds to a binary, and flag growth. The report
+groups symbols by name without their template arguments, e.g. every ``Str<N>::insert``, using ``tools/python/
+lil_size_report.py`` and the toolchain's ``nm``. Bloaty_ is optional; when found, a second target gives its more
+detailed breakdown.
+
+Cache Variables
+^^^^^^^^^^^^^^^
+.. variable:: BLOATY_EXECUTABLE
+
+  Path to ``bloaty``, if found.
+
+Functions
+^^^^^^^^^
+.. command:: add_size_report_target
+
+  .. code-block:: cmake
+
+    add_size_report_target(<name> TARGET <target> [PATTERN <regex>] [BASELINE <file>] [TOLERANCE <bytes>])
+
+  Adds ``<name>``, which prints the size of the symbols of ``<target>`` matching ``<regex>`` and fails if a group grew
+  by more than ``<bytes>`` (default 0) since ``<file>`` was recorded, and ``<name>.update``, which records it.
+  ``<file>`` defaults to ``${CMAKE_BINARY_DIR}/<name>.json``; sizes depend on the compiler and build type, so record it
+  with the same toolchain, e.g. before a change. Adds ``<name>.bloaty`` if Bloaty_ was found.
+
+Example Usages:
+
+.. code-block:: cmake
+
+  find_package(Bloaty)
+  add_size_report_target(firmware.size TARGET firmware PATTERN "lil::")
+#]=======================================================================]
+cmake_minimum_required(VERSION 3.12)
+include_guard(GLOBAL)
+
+find_package(Python3 COMPONENTS Interpreter QUIET)
+find_program(BLOATY_EXECUTABLE bloaty)
+mark_as_advanced(BLOATY_EXECUTABLE)
+
+set(_sizeReportScript ${CMAKE_CURRENT_LIST_DIR}/../../python/lil_size_report.py)
+
+function(add_size_report_target name)
+  cmake_parse_arguments(arg "" "TARGET;PATTERN;BASELINE;TOLERANCE" "" ${ARGN})
+  if (NOT arg_TARGET)
+    message(FATAL_ERROR "add_size_report_target requires a TARGET")
+  endif()
+  if (NOT arg_PATTERN)
+    set(arg_PATTERN ".")
+  endif()
+  if (NOT arg_BASELINE)
+    set(arg_BASELINE ${CMAKE_BINARY_DIR}/${name}.json)
+  endif()
+  if (NOT arg_TOLERANCE)
+    set(arg_TOLERANCE 0)
+  endif()
+  if (NOT Python3_Interpreter_FOUND OR NOT CMAKE_NM)
+    message(STATUS "Skipping ${name}: requires a python 3 interpreter and nm")
+    return()
+  endif()
+
+  set(report ${Python3_EXECUTABLE} ${_sizeReportScript} --nm ${CMAKE_NM} --pattern ${arg_PATTERN}
+      --baseline ${arg_BASELINE})
+  add_custom_target(${name}
+    COMMAND ${report} --tolerance ${arg_TOLERANCE} $<TARGET_FILE:${arg_TARGET}>
+    DEPENDS ${arg_TARGET}
+    COMMENT "Reporting the size of ${arg_TARGET} against ${arg_BASELINE}"
+    USES_TERMINAL
+    VERBATIM
+  )
+  add_custom_target(${name}.update
+    COMMAND ${report} --update $<TARGET_FILE:${arg_TARGET}>
+    DEPENDS ${arg_TARGET}
+    VERBATIM
+  )
+  if (BLOATY_EXECUTABLE)
+    add_custom_target(${name}.bloaty
+      COMMAND ${BLOATY_EXECUTABLE} -d symbols -n 0 --source-filter=${arg_PATTERN} $<TARGET_FILE:${arg_TARGET}>
+      DEPENDS ${arg_TARGET}
+      USES_TERMINAL
+      VERBATIM
+    )
+  endif()
+endfunction()
@@ -260,6 +260,8 @@ endif()
 # Let CMake handle the details
 include(FindPackageHandleStandardArgs)
 find_package_handle_standard_args(FreeRTOS
+  REQUIRED_VARS
+    FreeRTOS_ROOT
   HANDLE_COMPONENTS
   HANDLE_VERSION_RANGE
   NAME_MISMATCHED
@@ -2,33 +2,40 @@
 FindProfileGuidedOptimization
 -----------------------------
 
-Lorem ipsum.
+Generates targets and a training target for profile guided optimization (PGO). Code is first built instrumented, run on
+a representative workload to record which branches and functions are hot, then rebuilt with those profiles so the
+compiler can lay out and inline accordingly.
 
 Cache Variables
 ^^^^^^^^^^^^^^^
 .. variable:: PROFILE_GUIDED_OPTIMIZATION_DATA_DIR
 
-  Instrument Lorem ipsum
+  Directory where instrumented binaries write profiles and optimized builds read them from.
 
 .. variable:: ${PROJECT_NAME}_ENABLE_PGO_GENERATE
 
-  Lorem ipsum
+  Links every target with ``ProfileGuidedOptimization::Generate`` (see BaseProject).
 
 .. variable:: ${PROJECT_NAME}_ENABLE_PGO_USE
 
-  Lorem ipsum
+  Links every target with ``ProfileGuidedOptimization::Use`` (see BaseProject).
 
 Imported Targets
 ^^^^^^^^^^^^^^^^
 ``ProfileGuidedOptimization::Generate``
 
-  Lorem ipsum
+  Compile and link options that instrument code to write profiles to :variable:`PROFILE_GUIDED_OPTIMIZATION_DATA_DIR`.
+
+``ProfileGuidedOptimization::Use``
+
+  Compile and link options that optimize code using the profiles in :variable:`PROFILE_GUIDED_OPTIMIZATION_DATA_DIR`.
 
 Example Usages:
 
 .. code-block:: cmake
 
   find_package(ProfileGuidedOptimization)
+  add_profile_guided_optimization_target(main.pgo TARGET main TRAINING_ARGS --workload=typical)
 #]=======================================================================]
 cmake_minimum_required(VERSION 3.13)
 include_guard(GLOBAL)
@@ -45,10 +52,12 @@ set(testFlags -fprofile-generate=${PROFILE_GUIDED_OPTIMIZATION_DATA_DIR})
 set(PROFILE_GUIDED_OPTIMIZATION_GENERATE_FLAGS "")
 foreach(flag IN LISTS testFlags)
   string(MAKE_C_IDENTIFIER ${flag}_cflag_supported this_cflag_supported)
+  # The check links, and instrumented objects only link against the profiling runtime the flag itself pulls in
+  set(CMAKE_REQUIRED_LINK_OPTIONS ${flag})
   check_c_compiler_flag(${flag} ${this_cflag_supported})
+  unset(CMAKE_REQUIRED_LINK_OPTIONS)
   if (${this_cflag_supported})
     list(APPEND PROFILE_GUIDED_OPTIMIZATION_GENERATE_FLAGS ${flag})
-    set(${this_cflag_supported} "" CACHE INTERNAL "" FORCE)
   endif()
 endforeach()
 
@@ -60,6 +69,8 @@ target_compile_options(.profileguidedoptimization.generate
 target_link_options(.profileguidedoptimization.generate
   INTERFACE
     $<$<C_COMPILER_ID:MSVC>:"LINKER:/LTCG LINKER:/GENPROFILE">
+    # GCC links its profiling runtime, and link time optimization needs the flags again at link time
+    $<$<NOT:$<C_COMPILER_ID:MSVC>>:${PROFILE_GUIDED_OPTIMIZATION_GENERATE_FLAGS}>
 )
 add_library(ProfileGuidedOptimization::Generate ALIAS .profileguidedoptimization.generate)
 
@@ -68,12 +79,14 @@ add_library(ProfileGuidedOptimization::Generate ALIAS .profileguidedoptimization
 # ============================================================================ #
 set(testFlags -fprofile-use=${PROFILE_GUIDED_OPTIMIZATION_DATA_DIR})
 set(PROFILE_GUIDED_OPTIMIZATION_USE_FLAGS "")
-foreach(flag IN LISTS arg_FLAGS testFlags)
+foreach(flag IN LISTS testFlags)
   string(MAKE_C_IDENTIFIER ${flag}_cflag_supported this_cflag_supported)
+  # The check links, and instrumented objects only link against the profiling runtime the flag itself pulls in
+  set(CMAKE_REQUIRED_LINK_OPTIONS ${flag})
   check_c_compiler_flag(${flag} ${this_cflag_supported})
+  unset(CMAKE_REQUIRED_LINK_OPTIONS)
   if (${this_cflag_supported})
     list(APPEND PROFILE_GUIDED_OPTIMIZATION_USE_FLAGS ${flag})
-    set(${this_cflag_supported} "" CACHE INTERNAL "" FORCE)
   endif()
 endforeach()
 
@@ -82,8 +95,98 @@ target_compile_options(.profileguidedoptimization.use
   INTERFACE
     ${PROFILE_GUIDED_OPTIMIZATION_USE_FLAGS}
 )
-target_link_options(.profileguidedoptimization.generate
+target_link_options(.profileguidedoptimization.use
   INTERFACE
     $<$<C_COMPILER_ID:MSVC>:"LINKER:/LTCG LINKER:/USEPROFILE">
+    $<$<NOT:$<C_COMPILER_ID:MSVC>>:${PROFILE_GUIDED_OPTIMIZATION_USE_FLAGS}>
 )
 add_library(ProfileGuidedOptimization::Use ALIAS .profileguidedoptimization.use)
+
+# ============================================================================ #
+# Training
+# ============================================================================ #
+#[=======================================================================[.rst:
+.. command:: add_profile_guided_optimization_target
+
+  Adds a target that builds an instrumented executable, trains it, and rebuilds it and every library it links with the
+  recorded profiles.
+
+  Signatures::
+
+    add_profile_guided_optimization_target(<name>
+      TARGET <target>
+      [TRAINING_ARGS <arg>...]
+      [ARGS <arg>...]
+    )
+
+  The options are:
+
+  ``TARGET <target>``
+  Executable whose run is the training workload.
+
+  ``TRAINING_ARGS <arg>...``
+  Arguments for the instrumented run.
+
+  ``ARGS <arg>...``
+  Arguments for a final run of the optimized executable, e.g. to record its results.
+
+  Both builds happen in ``${CMAKE_BINARY_DIR}/pgo``, reconfigured in place from ``${PROJECT_NAME}_ENABLE_PGO_GENERATE``
+  to ``${PROJECT_NAME}_ENABLE_PGO_USE``: GCC matches profiles to object files by path, so the optimized objects must be
+  built where the instrumented ones were. Clang's raw profiles are merged with ``llvm-profdata`` in between.
+#]=======================================================================]
+function(add_profile_guided_optimization_target name)
+  list(APPEND CMAKE_MESSAGE_INDENT "[ProfileGuidedOptimization::add_profile_guided_optimization_target] ")
+  message(VERBOSE "(${ARGV})")
+  set(optArgs)
+  set(oneValueArgs TARGET)
+  set(multiValueArgs TRAINING_ARGS ARGS)
+  cmake_parse_arguments(arg "${optArgs}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+  if (NOT arg_TARGET)
+    message(FATAL_ERROR "requires: TARGET <target>")
+  endif()
+
+  set(buildDir ${CMAKE_BINARY_DIR}/pgo)
+  set(dataDir ${buildDir}/profiles)
+  set(executable ${buildDir}/${CMAKE_INSTALL_BINDIR}/$<TARGET_FILE_NAME:${arg_TARGET}>)
+  set(configure
+    ${CMAKE_COMMAND} -S ${PROJECT_SOURCE_DIR} -B ${buildDir} -G ${CMAKE_GENERATOR}
+      -DCMAKE_BUILD_TYPE=Release
+      -DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}
+      -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}
+      -DPROFILE_GUIDED_OPTIMIZATION_DATA_DIR=${dataDir}
+      -DCCACHE_ENABLE=OFF
+      -D${PROJECT_NAME}_BUILD_DOCS=OFF
+      -D${PROJECT_NAME}_BUILD_TESTS=OFF
+  )
+  if (DEFINED ${PROJECT_NAME}_LINKER_EXECUTABLE)
+    list(APPEND configure -D${PROJECT_NAME}_LINKER_EXECUTABLE=${${PROJECT_NAME}_LINKER_EXECUTABLE})
+  endif()
+
+  set(merge)
+  if (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    find_program(LLVM_PROFDATA llvm-profdata REQUIRED)
+    set(mergeScript ${CMAKE_CURRENT_BINARY_DIR}/${name}.merge.cmake)
+    file(WRITE ${mergeScript}
+      "file(GLOB raw \"${dataDir}/*.profraw\")\n"
+      "execute_process(COMMAND \"${LLVM_PROFDATA}\" merge -output=\"${dataDir}/default.profdata\" \${raw} "
+      "RESULT_VARIABLE result)\n"
+      "if (result)\n  message(FATAL_ERROR \"llvm-profdata failed: \${result}\")\nendif()\n"
+    )
+    set(merge COMMAND ${CMAKE_COMMAND} -P ${mergeScript})
+  endif()
+
+  add_custom_target(${name}
+    COMMAND ${CMAKE_COMMAND} -E remove_directory ${dataDir}
+    COMMAND ${configure} -D${PROJECT_NAME}_ENABLE_PGO_GENERATE=ON -D${PROJECT_NAME}_ENABLE_PGO_USE=OFF
+    COMMAND ${CMAKE_COMMAND} --build ${buildDir} --target ${arg_TARGET}
+    COMMAND ${executable} ${arg_TRAINING_ARGS}
+    ${merge}
+    COMMAND ${configure} -D${PROJECT_NAME}_ENABLE_PGO_GENERATE=OFF -D${PROJECT_NAME}_ENABLE_PGO_USE=ON
+    COMMAND ${CMAKE_COMMAND} --build ${buildDir} --target ${arg_TARGET}
+    COMMAND ${executable} ${arg_ARGS}
+    COMMENT "Training and rebuilding ${arg_TARGET} with profile guided optimization"
+    USES_TERMINAL
+    VERBATIM
+  )
+endfunction()
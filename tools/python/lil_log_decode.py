@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Decodes binary LIL_LOG records and LIL_ASSERT telemetry back into text using the ELF that produced them.
+
+Usage: lil_log_decode.py firmware.elf log.bin
+       lil_log_decode.py firmware.elf - < log.bin
+       lil_log_decode.py --asserts firmware.elf asserts.bin
+
+The log is the raw byte stream drained from lil::logBuffer(). Every LIL_LOG call site leaves an entry in the ELF of the
+form MAGIC "file:line" NUL format NUL, and its records start with the 32 bit FNV-1a hash of that entry (without the
+final NUL), followed by the arguments after C varargs promotion. The entries must keep their contents in the ELF, so
+link the lil_log.* sections into a non-allocated (INFO) section rather than a NOLOAD one. LIL_ASSERT sites are interned
+the same way, with the expression in place of the format; with --asserts the input is the output of
+lil::serializeAsserts() instead, and each failed site is listed with its failure count. Only the standard library is
+required.
+"""
+
+import re
+import struct
+import sys
+
+MAGIC = b"\x1fLIL\x1f"
+DROPPED_ID = 0
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+CONVERSION = re.compile(rb"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXeEfFgGaAcsp%])")
+
+
+def fnv1a(data):
+    value = 0x811C9DC5
+    for byte in data:
+        value = ((value ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+
+class Elf:
+    """The subset of an ELF file needed to find log entries and resolve string arguments."""
+
+    def __init__(self, data):
+        if data[:4] != b"\x7fELF":
+            raise ValueError("not an ELF file")
+        self.data = data
+        self.wide = data[4] == 2
+        self.endian = "<" if data[5] == 1 else ">"
+        self.pointer_size = 8 if self.wide else 4
+        if self.wide:
+            shoff, = struct.unpack_from(self.endian + "Q", data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", data, 0x3A)
+            layout = "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(self.endian + "I", data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", data, 0x2E)
+            layout = "IIIIIIIIII"
+        self.sections = []
+        for index in range(shnum):
+            name, kind, flags, addr, offset, size = struct.unpack_from(self.endian + layout, data,
+                                                                       shoff + (index * shentsize))[:6]
+            self.sections.append({"name": name, "type": kind, "flags": flags, "addr": addr, "offset": offset,
+                                  "size": size})
+        names = self.contents(self.sections[shstrndx]) if shstrndx < shnum else b""
+        for section in self.sections:
+            start = section["name"]
+            end = names.find(b"\0", start)
+            section["name"] = names[start:end] if end >= 0 else b""
+
+    def contents(self, section):
+        if section["type"] == SHT_NOBITS:
+            return b""
+        return self.data[section["offset"]:section["offset"] + section["size"]]
+
+    def entries(self):
+        """Maps each call site ID to its (location, format); entries may sit in any section, e.g. .rodata for
+        templates."""
+        found = {}
+        for section in self.sections:
+            if (section["type"] == SHT_NOBITS) and section["name"].startswith(b"lil_log"):
+                raise ValueError("section %s holds no contents, so its log entries are lost; link it as a "
+                                 "non-allocated (INFO) section rather than NOLOAD" % section["name"].decode())
+            contents = self.contents(section)
+            start = contents.find(MAGIC)
+            while start >= 0:
+                location_end = contents.find(b"\0", start)
+                format_end = contents.find(b"\0", location_end + 1)
+                if (location_end < 0) or (format_end < 0):
+                    break
+                location = contents[start + len(MAGIC):location_end]
+                found[fnv1a(contents[start:format_end])] = (location, contents[location_end + 1:format_end])
+                start = contents.find(MAGIC, format_end)
+        return found
+
+    def string_at(self, address):
+        for section in self.sections:
+            if (section["flags"] & SHF_ALLOC) and (section["addr"] <= address < section["addr"] + section["size"]):
+                contents = self.contents(section)
+                offset = address - section["addr"]
+                end = contents.find(b"\0", offset)
+                return contents[offset:end if end >= 0 else len(contents)]
+        return b"<0x%x>" % address
+
+
+class Reader:
+    def __init__(self, data, endian):
+        self.data = data
+        self.endian = endian
+        self.offset = 0
+
+    def remaining(self):
+        return len(self.data) - self.offset
+
+    def take(self, size, signed=False, floating=False):
+        if self.remaining() < size:
+            raise EOFError("log ends inside a record")
+        chunk = self.data[self.offset:self.offset + size]
+        self.offset += size
+        if floating:
+            return struct.unpack(self.endian + "d", chunk)[0]
+        return int.from_bytes(chunk, "little" if self.endian == "<" else "big", signed=signed)
+
+
+def argument_size(elf, length, conversion):
+    if conversion in b"eEfFgGaA":
+        return 8
+    if conversion in b"sp":
+        return elf.pointer_size
+    if length in (b"ll", b"j"):
+        return 8
+    if length in (b"l", b"z", b"t"):
+        return elf.pointer_size
+    return 4  # int, and anything narrower after promotion
+
+
+def format_record(elf, reader, text):
+    """Rebuilds text from its format, consuming its arguments from reader."""
+    out = []
+    position = 0
+    for match in CONVERSION.finditer(text):
+        out.append(text[position:match.start()])
+        position = match.end()
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == b"%":
+            out.append(b"%")
+            continue
+        if width == b"*":
+            width = b"%d" % reader.take(4, signed=True)
+        if precision == b"*":
+            precision = b"%d" % reader.take(4, signed=True)
+        spec = b"%" + flags + (width or b"") + ((b"." + precision) if precision is not None else b"")
+        size = argument_size(elf, length, conversion)
+        if conversion in b"eEfFgGaA":
+            value = reader.take(size, floating=True)
+            conversion = b"e" if conversion in b"aA" else conversion
+        elif conversion == b"s":
+            value = elf.string_at(reader.take(size))
+        elif conversion == b"p":
+            value, conversion = reader.take(size), b"x"
+            spec = b"%#" + spec[1:]
+        elif conversion == b"c":
+            value = reader.take(size) & 0xFF
+        else:
+            value = reader.take(size, signed=conversion in b"di")
+            conversion = b"d" if conversion in b"iu" else conversion
+        out.append((spec + conversion) % value)
+    out.append(text[position:])
+    return b"".join(out).decode(errors="replace")
+
+
+def decode(elf, log):
+    entries = elf.entries()
+    reader = Reader(log, elf.endian)
+    while reader.remaining() > 0:
+        call_site = reader.take(4)
+        if call_site == DROPPED_ID:
+            yield "<%d records dropped>" % reader.take(4)
+            continue
+        if call_site not in entries:
+            raise ValueError("unknown log ID 0x%08x at offset %d; was the log produced by this ELF?" %
+                             (call_site, reader.offset - 4))
+        location, text = entries[call_site]
+        yield "%s: %s" % (location.decode(errors="replace"), format_record(elf, reader, text))
+
+
+def decode_asserts(elf, asserts):
+    entries = elf.entries()
+    reader = Reader(asserts, "<")
+    for _ in range(reader.take(2)):
+        site = reader.take(4)
+        failures = reader.take(4)
+        if site not in entries:
+            raise ValueError("unknown assert ID 0x%08x; were the asserts produced by this ELF?" % site)
+        location, expression = entries[site]
+        yield "%s: %s failed %d times" % (location.decode(errors="replace"), expression.decode(errors="replace"),
+                                          failures)
+
+
+def main(argv):
+    asserts = (len(argv) == 4) and (argv[1] == "--asserts")
+    if asserts:
+        argv = argv[:1] + argv[2:]
+    if len(argv) != 3:
+        sys.stderr.write(__doc__)
+        return 2
+    with open(argv[1], "rb") as file:
+        elf = Elf(file.read())
+    if argv[2] == "-":
+        log = sys.stdin.buffer.read()
+    else:
+        with open(argv[2], "rb") as file:
+            log = file.read()
+    try:
+        for line in (decode_asserts if asserts else decode)(elf, log):
+            print(line)
+    except (EOFError, ValueError) as error:
+        sys.stderr.write("lil_log_decode: %s\n" % error)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
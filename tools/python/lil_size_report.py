@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Reports the code size of template instantiations in a binary, and flags growth against a recorded baseline.
+
+Usage: lil_size_report.py [--nm NM] [--pattern REGEX] [--baseline FILE [--update] [--tolerance BYTES]] [--verbose]
+                          binary
+
+Symbols whose demangled name matches REGEX are grouped by name with their template arguments removed, so that e.g.
+every Str<N>::insert forms one group. For each group the report lists the number of instantiations, their total size
+and the average size of each; --verbose lists them all. With --baseline, each group's total is compared with the one
+recorded in FILE, if it exists, and the exit status is 1 if any grew by more than BYTES; --update records the current
+totals instead. Baselines depend on the compiler and build type they were recorded with. Only the standard library and
+nm are required.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+
+def strip_template_arguments(name):
+    """Replaces every outermost <...> in a demangled name with <>, leaving operator<, operator<< etc. alone."""
+    out = []
+    depth = 0
+    i = 0
+    while i < len(name):
+        operator = re.match(r"operator(<<=|<<|<=>|<=|<|>>=|>>|>=|>|->)", name[i:])
+        if operator and depth == 0:
+            out.append(operator.group(0))
+            i += len(operator.group(0))
+            continue
+        char = name[i]
+        if char == "<":
+            if depth == 0:
+                out.append("<")
+            depth += 1
+        elif char == ">" and depth > 0:
+            depth -= 1
+            if depth == 0:
+                out.append(">")
+        elif depth == 0:
+            out.append(char)
+        i += 1
+    return "".join(out)
+
+
+def read_symbols(nm, binary):
+    """Yields (size, demangled name) for every sized symbol in the code sections of binary."""
+    output = subprocess.run([nm, "--demangle", "--print-size", "--size-sort", binary], check=True,
+                            stdout=subprocess.PIPE, universal_newlines=True).stdout
+    for line in output.splitlines():
+        fields = line.split(" ", 3)
+        if len(fields) == 4 and fields[2] in "tTwW":
+            yield int(fields[1], 16), fields[3]
+
+
+def group(symbols, pattern):
+    groups = {}
+    for size, name in symbols:
+        if pattern.search(name):
+            groups.setdefault(strip_template_arguments(name), []).append((size, name))
+    return groups
+
+
+def report(groups, baseline, tolerance, verbose):
+    """Prints one line per group, biggest first, and returns the groups that grew by more than tolerance."""
+    grown = []
+    totals = {key: sum(size for size, _ in members) for key, members in groups.items()}
+    for key in sorted(set(totals) | set(baseline), key=lambda key: -totals.get(key, 0)):
+        members = groups.get(key, [])
+        total = totals.get(key, 0)
+        each = (total // len(members)) if members else 0
+        line = "%8d B = %3d x %5d B  %s" % (total, len(members), each, key)
+        if baseline:
+            delta = total - baseline.get(key, 0)
+            line += "  (%+d B)" % delta
+            if delta > tolerance:
+                grown.append(key)
+                line += "  GREW"
+        print(line)
+        for size, name in sorted(members, reverse=True) if verbose else []:
+            print("%26d B  %s" % (size, name))
+    print("%8d B total" % sum(totals.values()))
+    return grown
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("binary")
+    parser.add_argument("--nm", default="nm")
+    parser.add_argument("--pattern", default=".", help="regular expression selecting the symbols to report")
+    parser.add_argument("--baseline", help="JSON file of group totals to compare with")
+    parser.add_argument("--update", action="store_true", help="record the current totals as the baseline")
+    parser.add_argument("--tolerance", type=int, default=0, help="bytes a group may grow by without failing")
+    parser.add_argument("--verbose", action="store_true", help="list every instantiation")
+    args = parser.parse_args(argv[1:])
+
+    groups = group(read_symbols(args.nm, args.binary), re.compile(args.pattern))
+    if args.update:
+        with open(args.baseline, "w") as file:
+            totals = {key: sum(size for size, _ in members) for key, members in groups.items()}
+            json.dump(totals, file, indent=2, sort_keys=True)
+            file.write("\n")
+        print("lil_size_report: recorded %d groups in %s" % (len(groups), args.baseline))
+        return 0
+
+    baseline = {}
+    if args.baseline and os.path.exists(args.baseline):
+        with open(args.baseline) as file:
+            baseline = json.load(file)
+    elif args.baseline:
+        print("lil_size_report: no baseline recorded in %s yet" % args.baseline)
+    grown = report(groups, baseline, args.tolerance, args.verbose)
+    if grown:
+        sys.stderr.write("lil_size_report: %d groups grew by more than %d B since %s\n" %
+                         (len(grown), args.tolerance, args.baseline))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))